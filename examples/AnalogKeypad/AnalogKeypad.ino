@@ -0,0 +1,68 @@
+/*
+ AnalogKeypad.ino - Example for the OneButtonLibrary library.
+ This is a sample sketch to show how to use the keys of a resistor ladder keypad
+ connected to a single analog input by using the OneButtonAnalog class.
+ The library internals are explained at
+ http://www.mathertel.de/Arduino/OneButtonLibrary.aspx
+
+ Setup a test circuit:
+ * Use a LCD keypad shield or connect 5 buttons by a resistor ladder to PIN_KEYPAD.
+ * The Serial interface is used for output the detected button events.
+
+ The value ranges below fit the common LCD keypad shield at 5V with a 10 bit ADC.
+ Print the value() of the keypad to find the ranges of your own circuit.
+ In the loop function only the keypad.tick function has to be called as often as you like.
+*/
+
+// 14.10.2026 created by Matthias Hertel
+
+#include "OneButtonAnalog.h"
+
+#define PIN_KEYPAD A0
+
+const char *names[5] = { "right", "up", "down", "left", "select" };
+const int minValues[5] = { 0, 100, 250, 450, 650 };
+const int maxValues[5] = { 50, 200, 400, 600, 850 };
+
+OneButton keys[5];
+OneButtonAnalog<5> keypad(PIN_KEYPAD);
+
+
+// this function will be called when a key was clicked.
+static void handleClick(void *parameter) {
+  Serial.print("click on ");
+  Serial.println((const char *)parameter);
+}  // handleClick
+
+
+// this function will be called when a key was held down.
+static void handleLongPress(void *parameter) {
+  Serial.print("long press on ");
+  Serial.println((const char *)parameter);
+}  // handleLongPress
+
+
+// setup code here, to run once:
+void setup() {
+  Serial.begin(115200);
+  Serial.println("Starting AnalogKeypad...");
+
+  for (uint8_t n = 0; n < 5; n++) {
+    keys[n].attachClick(handleClick, (void *)names[n]);
+    keys[n].attachLongPressStart(handleLongPress, (void *)names[n]);
+    keypad.add(keys[n], minValues[n], maxValues[n]);
+  }
+}  // setup
+
+
+// main code here, to run repeatedly:
+void loop() {
+  // keep watching all keys of the keypad:
+  keypad.tick();
+
+  // You can implement other code in here or just wait a while
+  delay(1);
+}  // loop
+
+
+// End
@@ -0,0 +1,100 @@
+/*
+ AutoRepeat.ino - Example for the OneButtonLibrary library.
+ This is a sample sketch to show how to scroll a value by holding a button
+ using the auto repeat of the DuringLongPress event with an acceleration table.
+ The library internals are explained at
+ http://www.mathertel.de/Arduino/OneButtonLibrary.aspx
+
+ Setup a test circuit:
+ * Connect a pushbutton to PIN_INPUT (ButtonPin) and ground.
+ * The Serial interface is used for output the value.
+
+ A click increments the value, a double click sets it back to 0.
+ Holding the button increments the value 500 msecs after the long press started,
+ then 3 times every 400 msecs, 5 times every 200 msecs and then every 50 msecs
+ in steps of 10 until the button is released.
+*/
+
+// 14.10.2026 created by Matthias Hertel
+
+#include "OneButton.h"
+
+#if defined(ARDUINO_AVR_UNO) || defined(ARDUINO_AVR_NANO_EVERY)
+// Example for Arduino UNO with input button on pin 2
+#define PIN_INPUT 2
+
+#elif defined(ESP8266)
+// Example for NodeMCU with input button using FLASH button on D3
+#define PIN_INPUT D3
+
+#elif defined(ESP32)
+// Example pin assignments for a ESP32 board
+// Some boards have a BOOT switch using GPIO 0.
+#define PIN_INPUT 0
+
+#endif
+
+OneButton button(PIN_INPUT, true);
+
+// the acceleration of the auto repeat.
+const oneButtonRepeatStep_t repeatCurve[] = {
+  { 3, 400 },  // 3 repeats every 400 msecs
+  { 5, 200 },  // then 5 repeats every 200 msecs
+  { 0, 50 },   // then every 50 msecs until the button is released
+};
+
+long value = 0;
+
+
+static void printValue() {
+  Serial.print("value = ");
+  Serial.println(value);
+}  // printValue()
+
+
+// this function will be called when the button was clicked.
+static void handleClick() {
+  value++;
+  printValue();
+}  // handleClick()
+
+
+// this function will be called when the button was double clicked.
+static void handleDoubleClick() {
+  value = 0;
+  printValue();
+}  // handleDoubleClick()
+
+
+// this function will be called on every repeat while the button is held down.
+static void handleRepeat() {
+  // scroll faster at the highest rate.
+  value += (button.getRepeatIntervalMs() <= 50) ? 10 : 1;
+  Serial.print(button.getRepeatCount());
+  Serial.print(": ");
+  printValue();
+}  // handleRepeat()
+
+
+// setup code here, to run once:
+void setup() {
+  Serial.begin(115200);
+  Serial.println("\nOneButton AutoRepeat Example.");
+  Serial.println("Please click or hold the button.");
+
+  button.attachClick(handleClick);
+  button.attachDoubleClick(handleDoubleClick);
+  button.attachDuringLongPress(handleRepeat);
+
+  // start the auto repeat 500 msecs after the long press was detected.
+  button.setPressMs(500);
+  button.setRepeat(repeatCurve, sizeof(repeatCurve) / sizeof(repeatCurve[0]), 500);
+}  // setup()
+
+
+// main code here, to run repeatedly:
+void loop() {
+  button.tick();
+}  // loop()
+
+// end.
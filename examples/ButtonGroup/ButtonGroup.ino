@@ -0,0 +1,88 @@
+/*
+ ButtonGroup.ino - Example for the OneButtonLibrary library.
+ This is a sample sketch to show how to scan many buttons together
+ by using the OneButtonGroup class.
+ The library internals are explained at
+ http://www.mathertel.de/Arduino/OneButtonLibrary.aspx
+
+ Setup a test circuit:
+ * Connect pushbuttons to the PIN_INPUT1..4 (see defines for processor specific examples) and ground.
+ * The Serial interface is used for output the detected button events.
+
+ The group reads the input registers of all used ports once per sample and
+ debounces all buttons in parallel.
+ In the loop function only the group.tick function has to be called as often as you like.
+*/
+
+// 14.10.2026 created by Matthias Hertel
+
+#include "OneButtonGroup.h"
+
+#if defined(ARDUINO_AVR_UNO) || defined(ARDUINO_AVR_NANO_EVERY)
+#define PIN_INPUT1 A0
+#define PIN_INPUT2 A1
+#define PIN_INPUT3 A2
+#define PIN_INPUT4 A3
+
+#elif defined(ESP8266)
+#define PIN_INPUT1 D1
+#define PIN_INPUT2 D2
+#define PIN_INPUT3 D3
+#define PIN_INPUT4 D4
+
+#elif defined(ESP32)
+#define PIN_INPUT1 25
+#define PIN_INPUT2 26
+#define PIN_INPUT3 32
+#define PIN_INPUT4 33
+
+#endif
+
+const uint8_t pins[4] = { PIN_INPUT1, PIN_INPUT2, PIN_INPUT3, PIN_INPUT4 };
+
+OneButton buttons[4];
+OneButtonGroup<4> group;
+
+
+// this function will be called when a button was clicked.
+static void handleClick(void *parameter) {
+  OneButton *button = (OneButton *)parameter;
+  Serial.print("click on pin ");
+  Serial.println(button->pin());
+}  // handleClick
+
+
+// this function will be called when a button was held down.
+static void handleLongPress(void *parameter) {
+  OneButton *button = (OneButton *)parameter;
+  Serial.print("long press on pin ");
+  Serial.println(button->pin());
+}  // handleLongPress
+
+
+// setup code here, to run once:
+void setup() {
+  Serial.begin(115200);
+  Serial.println("Starting ButtonGroup...");
+
+  for (uint8_t n = 0; n < 4; n++) {
+    buttons[n].setup(pins[n], INPUT_PULLUP, true);
+    buttons[n].attachClick(handleClick, &buttons[n]);
+    buttons[n].attachLongPressStart(handleLongPress, &buttons[n]);
+    group.add(buttons[n]);
+  }
+  group.setDebounceMs(40);
+}  // setup
+
+
+// main code here, to run repeatedly:
+void loop() {
+  // keep watching all buttons of the group:
+  group.tick();
+
+  // You can implement other code in here or just wait a while
+  delay(1);
+}  // loop
+
+
+// End
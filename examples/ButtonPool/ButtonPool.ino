@@ -0,0 +1,93 @@
+/*
+ ButtonPool.ino - Example for the OneButtonLibrary library.
+ This is a sample sketch to show how to create and remove buttons at runtime
+ without heap memory by using the OneButtonPool class.
+ The library internals are explained at
+ http://www.mathertel.de/Arduino/OneButtonLibrary.aspx
+
+ Setup a test circuit:
+ * Connect a pushbutton to PIN_INPUT and ground. It is always used.
+ * Connect a switch to PIN_MODULE and ground. It simulates a plugged in module with 2 more buttons.
+ * Connect pushbuttons to the module pins PIN_MODULE_1 and PIN_MODULE_2 and ground.
+ * The Serial interface is used for output the detected button events.
+
+ The buttons of the module are created when the switch is closed and removed when it is opened.
+ All buttons in use are ticked by tickAll().
+*/
+
+// 14.10.2026 created by Matthias Hertel
+
+#include "OneButtonPool.h"
+
+#if defined(ARDUINO_AVR_UNO) || defined(ARDUINO_AVR_NANO_EVERY)
+#define PIN_INPUT 2
+#define PIN_MODULE 3
+#define PIN_MODULE_1 4
+#define PIN_MODULE_2 5
+
+#elif defined(ESP8266)
+#define PIN_INPUT D3
+#define PIN_MODULE D5
+#define PIN_MODULE_1 D6
+#define PIN_MODULE_2 D7
+
+#elif defined(ESP32)
+#define PIN_INPUT 0
+#define PIN_MODULE 25
+#define PIN_MODULE_1 26
+#define PIN_MODULE_2 27
+
+#endif
+
+// space for up to 4 buttons.
+OneButtonPool<OneButton, 4> buttons;
+
+OneButton *module1 = NULL;
+OneButton *module2 = NULL;
+
+
+// this function will be called when a button was clicked.
+static void handleClick(void *button) {
+  Serial.print("click on pin ");
+  Serial.println(((OneButton *)button)->pin());
+}  // handleClick
+
+
+// create a button with its event functions.
+static OneButton *addButton(const int pin) {
+  OneButton *b = buttons.add(pin, true, true);
+  if (b) b->attachClick(handleClick, b);
+  return b;
+}  // addButton
+
+
+// setup code here, to run once:
+void setup() {
+  Serial.begin(115200);
+  Serial.println("\nOneButton ButtonPool Example.");
+  pinMode(PIN_MODULE, INPUT_PULLUP);
+
+  addButton(PIN_INPUT);
+}  // setup()
+
+
+// main code here, to run repeatedly:
+void loop() {
+  bool plugged = (digitalRead(PIN_MODULE) == LOW);
+
+  if (plugged && !module1) {
+    Serial.println("module plugged in.");
+    module1 = addButton(PIN_MODULE_1);
+    module2 = addButton(PIN_MODULE_2);
+
+  } else if (!plugged && module1) {
+    Serial.println("module removed.");
+    buttons.remove(*module1);
+    buttons.remove(*module2);
+    module1 = module2 = NULL;
+  }
+
+  buttons.tickAll();
+}  // loop()
+
+// end.
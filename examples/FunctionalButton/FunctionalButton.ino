@@ -1,7 +1,7 @@
 /**
  * FunctionalButton.ino - Example for the OneButtonLibrary library.
- * This is a sample sketch to show how to use OneClick library functionally on ESP32,ESP8266... 
- * 
+ * This is a sample sketch to show how to call member functions of a class from the events
+ * using OneButtonDelegate without std::function or heap memory.
  */
 #include <Arduino.h>
 #include <OneButton.h>
@@ -9,12 +9,12 @@
 class Button{
 private:
   OneButton button;
-  int value;
+  int value = 0;
 public:
   explicit Button(uint8_t pin):button(pin) {
-    button.attachClick([](void *scope) { ((Button *) scope)->Clicked();}, this);
-    button.attachDoubleClick([](void *scope) { ((Button *) scope)->DoubleClicked();}, this);
-    button.attachLongPressStart([](void *scope) { ((Button *) scope)->LongPressed();}, this);
+    button.attachClick(ONEBUTTON_DELEGATE(this, &Button::Clicked));
+    button.attachDoubleClick(ONEBUTTON_DELEGATE(this, &Button::DoubleClicked));
+    button.attachLongPressStart(ONEBUTTON_DELEGATE(this, &Button::LongPressed));
   }
 
   void Clicked(){
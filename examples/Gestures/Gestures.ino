@@ -0,0 +1,99 @@
+/*
+ Gestures.ino - Example for the OneButtonLibrary library.
+ This is a sample sketch to show how to detect chords and sequences
+ of several buttons by using the OneButtonGestures class.
+ The library internals are explained at
+ http://www.mathertel.de/Arduino/OneButtonLibrary.aspx
+
+ Setup a test circuit:
+ * Connect pushbuttons to the PIN_INPUT1..3 (see defines for processor specific examples) and ground.
+ * The Serial interface is used for output the detected gestures and button events.
+
+ Pressing button 1 and 2 together is reported as a chord,
+ a click on button 1 followed by a click on button 3 is reported as a sequence.
+ The single clicks of these gestures are not reported.
+*/
+
+// 14.10.2026 created by Matthias Hertel
+
+#include "OneButtonGroup.h"
+#include "OneButtonGestures.h"
+
+#if defined(ARDUINO_AVR_UNO) || defined(ARDUINO_AVR_NANO_EVERY)
+#define PIN_INPUT1 A0
+#define PIN_INPUT2 A1
+#define PIN_INPUT3 A2
+
+#elif defined(ESP8266)
+#define PIN_INPUT1 D1
+#define PIN_INPUT2 D2
+#define PIN_INPUT3 D3
+
+#elif defined(ESP32)
+#define PIN_INPUT1 25
+#define PIN_INPUT2 26
+#define PIN_INPUT3 32
+
+#endif
+
+const uint8_t pins[3] = { PIN_INPUT1, PIN_INPUT2, PIN_INPUT3 };
+
+const oneButtonGesture_t gestureTable[] = {
+  { OBG_CHORD, 0, 1, 100 },    // button 1 and 2 pressed within 100 msecs
+  { OBG_SEQUENCE, 0, 2, 500 }  // button 1 clicked, button 3 pressed within 500 msecs and clicked
+};
+
+OneButton buttons[3];
+OneButtonGroup<3> group;
+OneButtonGestures<3> gestures(gestureTable, 2);
+
+
+// this function will be called when a gesture was detected.
+static void handleGesture(uint8_t gesture, void *parameter) {
+  (void)parameter;
+  Serial.print("gesture ");
+  Serial.println(gesture);
+}  // handleGesture
+
+
+// this function will be called for all other button events.
+static void handleEvent(OneButton *button, oneButtonEvent_t event, void *parameter) {
+  (void)parameter;
+  if (event == OBE_CLICK) {
+    Serial.print("click on pin ");
+    Serial.println(button->pin());
+  } else if (event == OBE_LONGPRESSSTART) {
+    Serial.print("long press on pin ");
+    Serial.println(button->pin());
+  }
+}  // handleEvent
+
+
+// setup code here, to run once:
+void setup() {
+  Serial.begin(115200);
+  Serial.println("Starting Gestures...");
+
+  for (uint8_t n = 0; n < 3; n++) {
+    buttons[n].setup(pins[n], INPUT_PULLUP, true);
+    group.add(buttons[n]);
+    gestures.add(buttons[n]);
+  }
+  gestures.attachGesture(handleGesture);
+  gestures.attachEvent(handleEvent);
+}  // setup
+
+
+// main code here, to run repeatedly:
+void loop() {
+  // keep watching all buttons and pass the held back clicks:
+  unsigned long now = millis();
+  group.tickAll(now);
+  gestures.tick(now);
+
+  // You can implement other code in here or just wait a while
+  delay(1);
+}  // loop
+
+
+// End
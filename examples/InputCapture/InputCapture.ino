@@ -0,0 +1,76 @@
+/*
+ InputCapture.ino - Example for the OneButtonLibrary library.
+ This is a sample sketch to show how to measure the press duration of a button
+ using the exact edge times taken by a hardware input capture unit.
+ The library internals are explained at
+ http://www.mathertel.de/Arduino/OneButtonLibrary.aspx
+
+ Setup a test circuit:
+ * Connect a pushbutton to pin 8 (ICP1 on the Uno, PIN_INPUT) and ground.
+ * The Serial interface is used for output the detected button events.
+
+ The press duration is measured between the captured edges and does not depend
+ on the time the loop function calls tick().
+*/
+
+// 14.10.2026 created by Matthias Hertel
+
+#include "OneButtonCapture.h"
+
+#if defined(ARDUINO_AVR_UNO) || defined(ARDUINO_AVR_NANO)
+// the button must be connected to the ICP1 pin.
+#define PIN_INPUT 8
+
+#elif defined(ESP8266)
+#define PIN_INPUT D3
+
+#elif defined(ESP32) && defined(ARDUINO_NANO_ESP32)
+#define PIN_INPUT D3
+
+#elif defined(ESP32)
+// Some boards have a BOOT switch using GPIO 0.
+#define PIN_INPUT 0
+
+#else
+#define PIN_INPUT 2
+
+#endif
+
+OneButton button;
+
+
+// this function will be called when the button was released after a long press.
+static void handleLongPressStop() {
+  Serial.print("pressed for ");
+  Serial.print(button.getPressedMs());
+  Serial.println(" msecs");
+}  // handleLongPressStop
+
+
+// setup code here, to run once:
+void setup() {
+  Serial.begin(115200);
+  Serial.println("Starting InputCapture...");
+
+  button.setup(PIN_INPUT, INPUT_PULLUP, true);
+  button.attachLongPressStop(handleLongPressStop);
+
+  if (!OneButtonCapture::begin(button)) {
+    // no capture unit: use the pin change interrupt instead.
+    Serial.println("input capture not available.");
+    button.attachEdgeInterupt();
+  }
+}  // setup
+
+
+// main code here, to run repeatedly:
+void loop() {
+  // the edges are replayed with their captured times.
+  button.tick();
+
+  // other code may take longer without changing the measured duration.
+  delay(20);
+}  // loop
+
+
+// End
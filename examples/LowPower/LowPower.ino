@@ -0,0 +1,69 @@
+/*
+ LowPower.ino - Example for the OneButtonLibrary library.
+ This is a sample sketch to show how to let the processor sleep
+ while the buttons are not used by using the OneButtonPower class.
+ The library internals are explained at
+ http://www.mathertel.de/Arduino/OneButtonLibrary.aspx
+
+ Setup a test circuit:
+ * Connect a pushbutton to pin 2 (PIN_INPUT) and ground.
+ * The pin 13 (PIN_LED) is used for output attach a led and resistor to ground
+   or see the built-in led on the standard arduino board.
+
+ A click toggles the led. While the button is resting the processor is powered down
+ and a pin change wakes it up again.
+*/
+
+// 14.10.2026 created by Matthias Hertel
+
+#include "OneButtonPower.h"
+
+#if defined(ARDUINO_AVR_UNO) || defined(ARDUINO_AVR_NANO_EVERY)
+#define PIN_INPUT 2
+#define PIN_LED 13
+
+#elif defined(ESP8266)
+#define PIN_INPUT D3
+#define PIN_LED D4
+
+#elif defined(ESP32) && defined(ARDUINO_NANO_ESP32)
+#define PIN_INPUT D3
+#define PIN_LED LED_RED
+
+#elif defined(ESP32)
+// Some boards have a BOOT switch using GPIO 0.
+#define PIN_INPUT 0
+#define PIN_LED 25
+
+#endif
+
+OneButton button;
+
+bool ledState = false;
+
+
+// this function will be called when the button was clicked.
+static void handleClick() {
+  ledState = !ledState;
+  digitalWrite(PIN_LED, ledState);
+}  // handleClick
+
+
+// setup code here, to run once:
+void setup() {
+  pinMode(PIN_LED, OUTPUT);
+
+  button.setup(PIN_INPUT, INPUT_PULLUP, true);
+  button.attachClick(handleClick);
+  OneButtonPower::add(button);
+}  // setup
+
+
+// main code here, to run repeatedly:
+void loop() {
+  // tick the button and sleep until the next pin change or timeout.
+  OneButtonPower::tick();
+}  // loop
+
+
+// End
@@ -0,0 +1,83 @@
+/*
+ MatrixKeypad.ino - Example for the OneButtonLibrary library.
+ This is a sample sketch to show how to use a 4x4 matrix keypad
+ with the OneButtonMatrix class.
+ The library internals are explained at
+ http://www.mathertel.de/Arduino/OneButtonLibrary.aspx
+
+ Setup a test circuit:
+ * Connect the 4 row lines of the keypad to the pins in rowPins[]
+   and the 4 column lines to the pins in colPins[].
+ * The Serial interface is used for output the detected key events.
+
+ All keys share the timing configuration and the event functions
+ that get the index of the key (row * 4 + column) as parameter.
+*/
+
+// 14.10.2026 created by Matthias Hertel
+
+#include "OneButtonMatrix.h"
+
+#if defined(ARDUINO_AVR_UNO) || defined(ARDUINO_AVR_NANO_EVERY)
+const uint8_t rowPins[4] = { 2, 3, 4, 5 };
+const uint8_t colPins[4] = { 6, 7, 8, 9 };
+
+#elif defined(ESP8266)
+const uint8_t rowPins[4] = { D1, D2, D3, D4 };
+const uint8_t colPins[4] = { D5, D6, D7, D0 };
+
+#elif defined(ESP32)
+const uint8_t rowPins[4] = { 13, 14, 25, 26 };
+const uint8_t colPins[4] = { 27, 32, 33, 4 };
+
+#endif
+
+const char keyNames[] = "123A456B789C*0#D";
+
+OneButtonMatrix<4, 4> keypad(rowPins, colPins);
+
+
+// this function will be called when a key was clicked.
+static void handleClick(uint8_t index) {
+  Serial.print("click on key ");
+  Serial.println(keyNames[index]);
+}  // handleClick
+
+
+// this function will be called when a key was double clicked.
+static void handleDoubleClick(uint8_t index) {
+  Serial.print("double click on key ");
+  Serial.println(keyNames[index]);
+}  // handleDoubleClick
+
+
+// this function will be called when a key was held down.
+static void handleLongPress(uint8_t index) {
+  Serial.print("long press on key ");
+  Serial.println(keyNames[index]);
+}  // handleLongPress
+
+
+// setup code here, to run once:
+void setup() {
+  Serial.begin(115200);
+  Serial.println("Starting MatrixKeypad...");
+
+  keypad.begin();
+  keypad.attachClick(handleClick);
+  keypad.attachDoubleClick(handleDoubleClick);
+  keypad.attachLongPressStart(handleLongPress);
+}  // setup
+
+
+// main code here, to run repeatedly:
+void loop() {
+  // keep watching all keys:
+  keypad.tick();
+
+  // You can implement other code in here or just wait a while
+  delay(1);
+}  // loop
+
+
+// End
@@ -0,0 +1,101 @@
+/*
+ MultiCore.ino - Example for the OneButtonLibrary library.
+ This is a sample sketch to show how to scan a button on one core and
+ handle its events on the other core by using the OneButtonShared class.
+ The library internals are explained at
+ http://www.mathertel.de/Arduino/OneButtonLibrary.aspx
+
+ Setup a test circuit:
+ * Connect a pushbutton to the PIN_INPUT (see defines for processor specific examples) and ground.
+ * The Serial interface is used for output the detected button events.
+
+ On the ESP32 the button is ticked by a task on core 0 while loop() runs on core 1.
+ On the RP2040 the button is ticked by loop1() on the second core.
+ On single core processors the button is ticked in loop().
+*/
+
+// 14.10.2026 created by Matthias Hertel
+
+#include "OneButtonShared.h"
+
+#if defined(ARDUINO_AVR_UNO) || defined(ARDUINO_AVR_NANO_EVERY)
+#define PIN_INPUT 2
+
+#elif defined(ESP8266)
+#define PIN_INPUT D3
+
+#elif defined(ESP32) && defined(ARDUINO_NANO_ESP32)
+#define PIN_INPUT D3
+
+#elif defined(ESP32)
+// Some boards have a BOOT switch using GPIO 0.
+#define PIN_INPUT 0
+
+#elif defined(ARDUINO_ARCH_RP2040)
+#define PIN_INPUT 15
+
+#endif
+
+OneButton button;
+OneButtonShared<8> shared(button);
+
+
+#if defined(ESP32) && !CONFIG_FREERTOS_UNICORE
+#define SCAN_TASK 1
+
+// the scanning task on core 0.
+static void scanTask(void *parameter) {
+  (void)parameter;
+  for (;;) {
+    shared.tick();
+    vTaskDelay(1);
+  }
+}  // scanTask
+#endif
+
+
+// setup code here, to run once:
+void setup() {
+  Serial.begin(115200);
+  Serial.println("One Button Example with a multi core scanner.");
+
+  button.setup(PIN_INPUT, INPUT_PULLUP, true);
+  button.setLongPressIntervalMs(500);
+
+#if defined(SCAN_TASK)
+  xTaskCreatePinnedToCore(scanTask, "scan", 2048, NULL, 2, NULL, 0);
+#endif
+}  // setup
+
+
+#if defined(ARDUINO_ARCH_RP2040)
+// the second core of the RP2040 ticks the button.
+void loop1() {
+  shared.tick();
+  delay(1);
+}  // loop1
+#endif
+
+
+// main code here, to run repeatedly:
+void loop() {
+  oneButtonEventRecord_t record;
+  oneButtonSnapshot_t snapshot;
+
+#if !defined(SCAN_TASK) && !defined(ARDUINO_ARCH_RP2040)
+  shared.tick();
+#endif
+
+  while (shared.pop(record)) {
+    shared.read(snapshot);
+    Serial.print("event ");
+    Serial.print(record.event);
+    Serial.print(" clicks ");
+    Serial.print(record.clicks);
+    Serial.print(" pressed ");
+    Serial.println(snapshot.pressedMs);
+  }
+}  // loop
+
+
+// End
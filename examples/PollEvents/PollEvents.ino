@@ -0,0 +1,77 @@
+/*
+ PollEvents.ino - Example for the OneButtonLibrary library.
+ This is a sample sketch to show how to use the events returned by tick()
+ instead of attaching functions.
+ The library internals are explained at
+ http://www.mathertel.de/Arduino/OneButtonLibrary.aspx
+
+ Setup a test circuit:
+ * Connect a pushbutton to pin 2 (PIN_INPUT) and ground.
+ * The Serial interface is used for output the detected button events.
+
+ The events that are only detected on request are enabled by setPollEvents().
+ The result of tick() is checked in the loop function.
+*/
+
+// 14.10.2026 created by Matthias Hertel
+
+#include "OneButton.h"
+
+#if defined(ARDUINO_AVR_UNO) || defined(ARDUINO_AVR_NANO_EVERY)
+#define PIN_INPUT 2
+
+#elif defined(ESP8266)
+#define PIN_INPUT D3
+
+#elif defined(ESP32) && defined(ARDUINO_NANO_ESP32)
+#define PIN_INPUT D3
+
+#elif defined(ESP32)
+// Some boards have a BOOT switch using GPIO 0.
+#define PIN_INPUT 0
+
+#endif
+
+OneButton button;
+
+
+// setup code here, to run once:
+void setup() {
+  Serial.begin(115200);
+  Serial.println("Starting PollEvents...");
+
+  button.setup(PIN_INPUT, INPUT_PULLUP, true);
+  button.setPollEvents(OBM_DOUBLECLICK | OBM_MULTICLICK);
+}  // setup
+
+
+// main code here, to run repeatedly:
+void loop() {
+  // keep watching the push button:
+  uint8_t events = button.tick();
+
+  if (events & OBM_CLICK) {
+    Serial.println("click");
+
+  } else if (events & OBM_DOUBLECLICK) {
+    Serial.println("double click");
+
+  } else if (events & OBM_MULTICLICK) {
+    Serial.print("multi click: ");
+    Serial.println(button.getNumberClicks());
+  }
+
+  if (events & OBM_LONGPRESSSTART) Serial.println("long press start");
+
+  if (events & OBM_LONGPRESSSTOP) {
+    Serial.print("long press stop after ");
+    Serial.print(button.getPressedMs());
+    Serial.println(" msecs");
+  }
+
+  // You can implement other code in here or just wait a while
+  delay(1);
+}  // loop
+
+
+// End
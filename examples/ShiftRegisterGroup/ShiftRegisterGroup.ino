@@ -0,0 +1,77 @@
+/*
+ ShiftRegisterGroup.ino - Example for the OneButtonLibrary library.
+ This is a sample sketch to show how to scan many buttons connected to
+ a chain of 74HC165 shift registers by using the OneButtonGroup class.
+ The library internals are explained at
+ http://www.mathertel.de/Arduino/OneButtonLibrary.aspx
+
+ Setup a test circuit:
+ * Connect 2 chained 74HC165 shift registers to the SPI bus: QH of the first register to MISO,
+   CLK to SCK, SH/LD to PIN_LOAD and CLK INH to GND.
+ * Connect the 16 inputs by pullup resistors to VCC and by pushbuttons to ground.
+ * The Serial interface is used for output the detected button events.
+
+ All inputs are read in one SPI transfer and debounced in parallel.
+ In the loop function only the group.tick function has to be called as often as you like.
+*/
+
+// 14.10.2026 created by Matthias Hertel
+
+#include "OneButtonShiftRegisterInput.h"
+
+#if defined(ARDUINO_AVR_UNO) || defined(ARDUINO_AVR_NANO_EVERY)
+#define PIN_LOAD 10
+
+#elif defined(ESP8266)
+#define PIN_LOAD D2
+
+#elif defined(ESP32)
+#define PIN_LOAD 5
+
+#endif
+
+OneButton buttons[16];
+OneButtonGroup<16, OneButtonShiftRegisterInput<16>> group;
+
+
+// this function will be called when a button was clicked.
+static void handleClick(void *parameter) {
+  Serial.print("click on input ");
+  Serial.println((int)(intptr_t)parameter);
+}  // handleClick
+
+
+// this function will be called when a button was held down.
+static void handleLongPress(void *parameter) {
+  Serial.print("long press on input ");
+  Serial.println((int)(intptr_t)parameter);
+}  // handleLongPress
+
+
+// setup code here, to run once:
+void setup() {
+  Serial.begin(115200);
+  Serial.println("Starting ShiftRegisterGroup...");
+
+  group.input().begin(PIN_LOAD);
+
+  for (uint8_t n = 0; n < 16; n++) {
+    // buttons without a pin are active low.
+    buttons[n].attachClick(handleClick, (void *)(intptr_t)n);
+    buttons[n].attachLongPressStart(handleLongPress, (void *)(intptr_t)n);
+    group.add(buttons[n]);
+  }
+}  // setup
+
+
+// main code here, to run repeatedly:
+void loop() {
+  // keep watching all buttons of the group:
+  group.tick();
+
+  // You can implement other code in here or just wait a while
+  delay(1);
+}  // loop
+
+
+// End
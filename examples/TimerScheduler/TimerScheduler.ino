@@ -0,0 +1,77 @@
+/*
+ TimerScheduler.ino - Example for the OneButtonLibrary library.
+ This is a sample sketch to show how to tick the buttons from a hardware timer
+ so that events are detected even when loop() is blocked for a long time.
+ The library internals are explained at
+ http://www.mathertel.de/Arduino/OneButtonLibrary.aspx
+
+ Setup a test circuit:
+ * Connect a pushbutton to the PIN_INPUT (see defines for processor specific examples) and ground.
+ * The Serial interface is used for output the detected button events.
+
+ The buttons are ticked by the OneButtonScheduler every 5 msecs.
+ The events are stored in a OneButtonEventQueue and handled in loop() as no
+ event functions should be called from the timer interrupt.
+*/
+
+// 14.10.2026 created by Matthias Hertel
+
+#include "OneButtonEventQueue.h"
+#include "OneButtonScheduler.h"
+
+#if defined(ARDUINO_AVR_UNO) || defined(ARDUINO_AVR_NANO_EVERY)
+#define PIN_INPUT 2
+
+#elif defined(ESP8266)
+#define PIN_INPUT D3
+
+#elif defined(ESP32)
+// Some boards have a BOOT switch using GPIO 0.
+#define PIN_INPUT 0
+
+#endif
+
+OneButton button;
+OneButtonEventQueue<8> queue;
+
+
+// setup code here, to run once:
+void setup() {
+  Serial.begin(115200);
+  Serial.println("One Button Example with a timer scheduler.");
+
+  button.setup(PIN_INPUT, INPUT_PULLUP, true);
+  button.setLongPressIntervalMs(500);
+  queue.attach(button);
+
+  OneButtonScheduler::add(button);
+  if (!OneButtonScheduler::begin(5)) {
+    Serial.println("no timer available, ticking from loop().");
+  }
+}  // setup
+
+
+// main code here, to run repeatedly:
+void loop() {
+  oneButtonEventRecord_t record;
+
+  while (queue.pop(record)) {
+    Serial.print("event ");
+    Serial.print(record.event);
+    Serial.print(" clicks=");
+    Serial.print(record.clicks);
+    Serial.print(" pressed=");
+    Serial.print(record.pressedMs);
+    Serial.print(" at ");
+    Serial.println(record.time);
+  }
+
+  // without a hardware timer the buttons are ticked here.
+  OneButtonScheduler::run();
+
+  // a long running task does not lead to lost events.
+  delay(200);
+}  // loop
+
+
+// End
@@ -0,0 +1,81 @@
+/*
+ TinyArray.ino - Example for the OneButtonLibrary library.
+ This is a sample sketch to show how to use many buttons with the same
+ configuration and minimal RAM by using the OneButtonTinyArray class.
+ The library internals are explained at
+ http://www.mathertel.de/Arduino/OneButtonLibrary.aspx
+
+ Setup a test circuit:
+ * Connect pushbuttons to the pins listed in pins[] (see defines for processor specific examples) and ground.
+ * The Serial interface is used for output the detected button events.
+
+ All buttons share the timing configuration and the event functions
+ that get the index of the button as parameter.
+*/
+
+// 14.10.2026 created by Matthias Hertel
+
+#include "OneButtonTinyArray.h"
+
+#if defined(ARDUINO_AVR_UNO) || defined(ARDUINO_AVR_NANO_EVERY)
+const uint8_t pins[] = { 2, 3, 4, 5, 6, 7, 8, 9 };
+
+#elif defined(ESP8266)
+const uint8_t pins[] = { D1, D2, D3, D4, D5, D6, D7 };
+
+#elif defined(ESP32)
+const uint8_t pins[] = { 13, 14, 25, 26, 27, 32, 33 };
+
+#endif
+
+const uint8_t PIN_COUNT = sizeof(pins) / sizeof(pins[0]);
+
+OneButtonTinyArray<PIN_COUNT> buttons;
+
+
+// this function will be called when a button was clicked.
+static void handleClick(uint8_t index) {
+  Serial.print("click on button ");
+  Serial.println(index);
+}  // handleClick
+
+
+// this function will be called when a button was double clicked.
+static void handleDoubleClick(uint8_t index) {
+  Serial.print("double click on button ");
+  Serial.println(index);
+}  // handleDoubleClick
+
+
+// this function will be called when a button was held down.
+static void handleLongPress(uint8_t index) {
+  Serial.print("long press on button ");
+  Serial.println(index);
+}  // handleLongPress
+
+
+// setup code here, to run once:
+void setup() {
+  Serial.begin(115200);
+  Serial.println("Starting TinyArray...");
+
+  for (uint8_t n = 0; n < PIN_COUNT; n++) buttons.add(pins[n]);
+
+  buttons.setClickMs(300);
+  buttons.attachClick(handleClick);
+  buttons.attachDoubleClick(handleDoubleClick);
+  buttons.attachLongPressStart(handleLongPress);
+}  // setup
+
+
+// main code here, to run repeatedly:
+void loop() {
+  // keep watching all buttons:
+  buttons.tick();
+
+  // You can implement other code in here or just wait a while
+  delay(1);
+}  // loop
+
+
+// End
@@ -0,0 +1,25 @@
+/*
+ FootprintBaseline.ino - Footprint benchmark of the OneButton library.
+ The flash and RAM used by the Arduino core without any button.
+ The footprint report subtracts it from the sizes of the other Footprint sketches.
+*/
+
+// 14.10.2026 created by Matthias Hertel
+
+#include "OneButton.h"
+
+volatile uint8_t events = 0;
+
+void setup() {
+  pinMode(2, INPUT_PULLUP);
+#if !FOOTPRINT_SIZE_ONLY
+  Serial.begin(115200);
+  Serial.println(F("FOOTPRINT Baseline"));
+#endif
+}
+
+void loop() {
+  events += digitalRead(2);
+}
+
+// end.
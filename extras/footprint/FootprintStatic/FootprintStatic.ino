@@ -0,0 +1,96 @@
+/*
+ FootprintStatic.ino - Footprint benchmark of the OneButton library.
+ Measures the flash and RAM of OneButtonStatic buttons with all events enabled and attached
+ and the cpu cycles of tick().
+
+ Compile with FOOTPRINT_SIZE_ONLY=1 for the footprint report, it removes the measurement and Serial code.
+ FOOTPRINT_INSTANCES sets the number of buttons, the report takes the RAM per instance from 1 and 2 buttons.
+ Upload without these flags and open the Serial monitor at 115200 baud to get the size of an instance
+ and the cycles of a tick() on the board, see FootprintOneButton.
+*/
+
+// 14.10.2026 created by Matthias Hertel
+
+#include "OneButtonStatic.h"
+
+#ifndef FOOTPRINT_INSTANCES
+#define FOOTPRINT_INSTANCES 1
+#endif
+
+volatile uint8_t events = 0;
+
+static void onEvent() {
+  events++;
+}
+
+OneButtonStatic<2> button1;
+#if FOOTPRINT_INSTANCES > 1
+OneButtonStatic<3> button2;
+#endif
+
+template <class B>
+static void attachAll(B &b) {
+  b.attachPress(onEvent);
+  b.attachClick(onEvent);
+  b.attachDoubleClick(onEvent);
+  b.attachMultiClick(onEvent);
+  b.attachLongPressStart(onEvent);
+  b.attachDuringLongPress(onEvent);
+  b.attachLongPressStop(onEvent);
+  b.attachIdle(onEvent);
+}
+
+
+#if !FOOTPRINT_SIZE_ONLY
+static const unsigned int ROUNDS = 1000;
+
+// average cpu cycles of one call from the usecs of ROUNDS calls.
+static unsigned long cycles(const unsigned long us) {
+  return (unsigned long)((unsigned long long)us * (F_CPU / 1000000L) / ROUNDS);
+}
+
+static void measure() {
+  OneButtonStatic<3> b;
+  b.setup();
+  attachAll(b);
+
+  unsigned long start = micros();
+  for (unsigned int n = 0; n < ROUNDS; n++) b.tick();
+  unsigned long idleUs = micros() - start;
+
+  start = micros();
+  for (unsigned int n = 0; n < ROUNDS; n++) b.tick(true, 10000UL + n);
+  unsigned long pressUs = micros() - start;
+
+  Serial.print(F("FOOTPRINT OneButtonStatic sizeof="));
+  Serial.print(sizeof(OneButtonStatic<3>));
+  Serial.print(F(" idle="));
+  Serial.print(cycles(idleUs));
+  Serial.print(F(" press="));
+  Serial.println(cycles(pressUs));
+}
+#endif
+
+
+void setup() {
+  button1.setup();
+  attachAll(button1);
+#if FOOTPRINT_INSTANCES > 1
+  button2.setup();
+  attachAll(button2);
+#endif
+
+#if !FOOTPRINT_SIZE_ONLY
+  Serial.begin(115200);
+  measure();
+#endif
+}
+
+void loop() {
+  button1.tick();
+#if FOOTPRINT_INSTANCES > 1
+  button2.tick();
+#endif
+}
+
+// end.
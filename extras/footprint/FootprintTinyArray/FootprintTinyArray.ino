@@ -0,0 +1,87 @@
+/*
+ FootprintTinyArray.ino - Footprint benchmark of the OneButton library.
+ Measures the flash and RAM of a OneButtonTinyArray with all events attached and the cpu cycles of tick().
+
+ Compile with FOOTPRINT_SIZE_ONLY=1 for the footprint report, it removes the measurement and Serial code.
+ FOOTPRINT_INSTANCES sets the number of buttons in the array, the report takes the RAM per button
+ from 1 and 2 buttons.
+ Upload without these flags and open the Serial monitor at 115200 baud to get the size of an array
+ with one button and the cycles of a tick() of one button on the board, see FootprintOneButton.
+*/
+
+// 14.10.2026 created by Matthias Hertel
+
+#include "OneButtonTinyArray.h"
+
+#ifndef FOOTPRINT_INSTANCES
+#define FOOTPRINT_INSTANCES 1
+#endif
+
+volatile uint8_t events = 0;
+
+static void onEvent(uint8_t index) {
+  events += index + 1;
+}
+
+OneButtonTinyArray<FOOTPRINT_INSTANCES> buttons;
+
+template <uint8_t N>
+static void attachAll(OneButtonTinyArray<N> &a) {
+  a.attachClick(onEvent);
+  a.attachDoubleClick(onEvent);
+  a.attachLongPressStart(onEvent);
+#if (ONEBUTTON_TINY_FEATURES & OBT_LONGPRESSSTOP)
+  a.attachLongPressStop(onEvent);
+#endif
+#if (ONEBUTTON_TINY_FEATURES & OBT_DURINGLONGPRESS)
+  a.attachDuringLongPress(onEvent);
+#endif
+}
+
+
+#if !FOOTPRINT_SIZE_ONLY
+static const unsigned int ROUNDS = 1000;
+
+// average cpu cycles of one call from the usecs of ROUNDS calls.
+static unsigned long cycles(const unsigned long us) {
+  return (unsigned long)((unsigned long long)us * (F_CPU / 1000000L) / ROUNDS);
+}
+
+static void measure() {
+  OneButtonTinyArray<1> a;
+  a.add(3);
+  attachAll(a);
+
+  unsigned long start = micros();
+  for (unsigned int n = 0; n < ROUNDS; n++) a.tick();
+  unsigned long idleUs = micros() - start;
+
+  start = micros();
+  for (unsigned int n = 0; n < ROUNDS; n++) a.tick(0, true, 10000UL + n);
+  unsigned long pressUs = micros() - start;
+
+  Serial.print(F("FOOTPRINT OneButtonTinyArray sizeof="));
+  Serial.print(sizeof(OneButtonTinyArray<1>));
+  Serial.print(F(" idle="));
+  Serial.print(cycles(idleUs));
+  Serial.print(F(" press="));
+  Serial.println(cycles(pressUs));
+}
+#endif
+
+
+void setup() {
+  for (uint8_t n = 0; n < FOOTPRINT_INSTANCES; n++) buttons.add(2 + n);
+  attachAll(buttons);
+
+#if !FOOTPRINT_SIZE_ONLY
+  Serial.begin(115200);
+  measure();
+#endif
+}
+
+void loop() {
+  buttons.tick();
+}
+
+// end.
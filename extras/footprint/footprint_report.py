@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+# -----
+# footprint_report.py - Create the footprint report of the OneButton library
+# from the sketch size reports of the arduino/compile-sketches action.
+#
+# usage: footprint_report.py <folder>
+#
+# The folder contains one sub folder per compilation named
+# footprint-<board>-<config>-<instances> with the json report of the action.
+# The flash and RAM of a sketch are the sizes above the FootprintBaseline sketch
+# of the same board and config, the RAM per instance is the difference of the
+# RAM of 2 and 1 instances.
+# -----
+# 14.10.2026 created by Matthias Hertel
+# -----
+
+import json
+import os
+import sys
+
+BASELINE = "FootprintBaseline"
+
+
+def size(sketch, name):
+    """Return the absolute size of the given name or None when not available."""
+    for s in sketch.get("sizes", []):
+        if s.get("name") == name:
+            value = s.get("current", {}).get("absolute")
+            return value if isinstance(value, int) else None
+    return None
+
+
+def load(folder):
+    """Return the sizes as {(board, config): {instances: {sketch: (flash, ram)}}}."""
+    data = {}
+    for entry in sorted(os.listdir(folder)):
+        parts = entry.split("-")
+        if (len(parts) != 4) or (parts[0] != "footprint"):
+            continue
+        config, instances = parts[2], int(parts[3])
+
+        path = os.path.join(folder, entry)
+        for file in sorted(os.listdir(path)):
+            if not file.endswith(".json"):
+                continue
+            with open(os.path.join(path, file)) as f:
+                report = json.load(f)
+            for board in report.get("boards", []):
+                sizes = data.setdefault((board["board"], config), {}).setdefault(instances, {})
+                for sketch in board.get("sketches", []):
+                    if sketch.get("compilation_success"):
+                        name = os.path.basename(sketch["name"].rstrip("/"))
+                        sizes[name] = (size(sketch, "flash"), size(sketch, "RAM for global variables"))
+    return data
+
+
+def delta(a, b):
+    return "-" if (a is None) or (b is None) else str(a - b)
+
+
+def report(data):
+    lines = []
+    for board in sorted(set(b for b, _ in data)):
+        lines.append("### " + board)
+        lines.append("")
+        lines.append("| Sketch | Config | Flash | RAM | RAM per instance |")
+        lines.append("| ------ | ------ | ----: | --: | ---------------: |")
+
+        for config in sorted(c for b, c in data if b == board):
+            one = data[(board, config)].get(1, {})
+            two = data[(board, config)].get(2, {})
+            base = one.get(BASELINE, (None, None))
+
+            for name in sorted(one):
+                if name == BASELINE:
+                    continue
+                flash, ram = one[name]
+                ram2 = two.get(name, (None, None))[1]
+                lines.append("| %s | %s | %s | %s | %s |" %
+                             (name, config, delta(flash, base[0]), delta(ram, base[1]), delta(ram2, ram)))
+        lines.append("")
+    return "\n".join(lines)
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 2:
+        print("usage: footprint_report.py <folder>")
+        sys.exit(1)
+    print(report(load(sys.argv[1])))
+
+# end.
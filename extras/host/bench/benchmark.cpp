@@ -0,0 +1,209 @@
+/**
+ * @file benchmark.cpp
+ *
+ * @brief Replay recorded button traces through the OneButton and OneButtonTiny
+ * state machines on a host computer and report the speed of tick() and the
+ * accuracy of the detected event times.
+ *
+ * This work is licensed under a BSD style license. See
+ * http://www.mathertel.de/License.aspx
+ */
+
+#include <chrono>
+#include <stdio.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAS_CYCLES 1
+#else
+#define HAS_CYCLES 0
+#endif
+
+#include "OneButton.h"
+#include "OneButtonTiny.h"
+#include "traces.h"
+
+// number of replays of every trace for the timing measurement.
+static const int REPEAT = 200;
+
+// ----- event recording -----
+
+struct recordedEvent_t {
+  oneButtonEvent_t event;
+  unsigned long time;
+};
+
+static recordedEvent_t recorded[16];
+static uint8_t recordedCount = 0;
+static bool recording = false;
+
+static void record(const oneButtonEvent_t event) {
+  if (recording && (recordedCount < 16)) {
+    recorded[recordedCount].event = event;
+    recorded[recordedCount].time = millis();
+    recordedCount++;
+  }
+}
+
+static void onClick() {
+  record(OBE_CLICK);
+}
+static void onDoubleClick() {
+  record(OBE_DOUBLECLICK);
+}
+static void onLongPressStart() {
+  record(OBE_LONGPRESSSTART);
+}
+static void onLongPressStop() {
+  record(OBE_LONGPRESSSTOP);
+}
+
+
+// ----- trace replay -----
+
+struct result_t {
+  unsigned long ticks;
+  double nsPerTick;
+  double cyclesPerTick;
+  long maxError;   // max. msecs of a detected event after its ideal time
+  uint8_t missed;  // expected events not detected
+  uint8_t extra;   // detected events not expected
+};
+
+static uint64_t cycles() {
+#if HAS_CYCLES
+  return __rdtsc();
+#else
+  return 0;
+#endif
+}
+
+// replay the trace once with 1 msec tick resolution.
+template <class BUTTON>
+static unsigned long replay(BUTTON &button, const trace_t &trace) {
+  uint8_t e = 0;
+  bool level = false;
+
+  OneButtonHost::setMillis(0);
+  for (unsigned long t = 0; t < trace.duration; t++) {
+    while ((e < trace.edgeCount) && (trace.edges[e].time == t)) level = trace.edges[e++].level;
+    button.tick(level);
+    OneButtonHost::advance(1);
+  }
+  return trace.duration;
+}
+
+// compare the recorded events with the expected events of the trace.
+static void compare(const trace_t &trace, const uint8_t supported, result_t &result) {
+  uint8_t r = 0;
+  result.maxError = 0;
+  result.missed = 0;
+  result.extra = 0;
+
+  for (uint8_t n = 0; n < trace.eventCount; n++) {
+    const traceEvent_t &expected = trace.events[n];
+    if (!(supported & (1 << expected.event))) continue;
+
+    if ((r < recordedCount) && (recorded[r].event == expected.event)) {
+      long error = (long)recorded[r].time - (long)expected.time;
+      if ((error < 0 ? -error : error) > (result.maxError < 0 ? -result.maxError : result.maxError)) result.maxError = error;
+      r++;
+    } else {
+      result.missed++;
+    }
+  }
+  result.extra = recordedCount - r;
+}
+
+template <class BUTTON>
+static void measure(const trace_t &trace, const uint8_t supported, void (*attach)(BUTTON &), result_t &result) {
+  // check the event timing with a single replay.
+  {
+    BUTTON button(2, true, false);
+    attach(button);
+    recordedCount = 0;
+    recording = true;
+    replay(button, trace);
+    recording = false;
+    compare(trace, supported, result);
+  }
+
+  // measure the execution time.
+  result.ticks = 0;
+  std::chrono::nanoseconds elapsed(0);
+  uint64_t cycleCount = 0;
+
+  for (int n = 0; n < REPEAT; n++) {
+    BUTTON button(2, true, false);
+    attach(button);
+
+    auto start = std::chrono::steady_clock::now();
+    uint64_t startCycles = cycles();
+    result.ticks += replay(button, trace);
+    cycleCount += cycles() - startCycles;
+    elapsed += std::chrono::steady_clock::now() - start;
+  }
+  result.nsPerTick = (double)elapsed.count() / result.ticks;
+  result.cyclesPerTick = (double)cycleCount / result.ticks;
+}
+
+#if ONEBUTTON_COMPACT_CALLBACKS
+// the compact build reports all events to a single function, only the events of the traces are recorded.
+// attachEvent() also waits for multi clicks, so the double click is reported after the click time.
+static void onEvent(OneButton *button, oneButtonEvent_t event, void *parameter) {
+  if ((1 << event) & (OBM_CLICK | OBM_DOUBLECLICK | OBM_LONGPRESSSTART | OBM_LONGPRESSSTOP)) record(event);
+}
+
+static void attachOneButton(OneButton &button) {
+  button.attachEvent(onEvent);
+}
+
+#else
+static void attachOneButton(OneButton &button) {
+  button.attachClick(onClick);
+  button.attachDoubleClick(onDoubleClick);
+  button.attachLongPressStart(onLongPressStart);
+  button.attachLongPressStop(onLongPressStop);
+}
+#endif
+
+static void attachTiny(OneButtonTiny &button) {
+  button.attachClick(onClick);
+  button.attachDoubleClick(onDoubleClick);
+  button.attachLongPressStart(onLongPressStart);
+}
+
+static void print(const char *className, const trace_t &trace, const result_t &result) {
+  printf("%-14s %-12s %12.0f %10.1f ", className, trace.name, 1e9 / result.nsPerTick, result.nsPerTick);
+  if (HAS_CYCLES) {
+    printf("%10.1f ", result.cyclesPerTick);
+  } else {
+    printf("%10s ", "n/a");
+  }
+  printf("%8ld %6d %6d\n", result.maxError, result.missed, result.extra);
+}
+
+
+int main() {
+  const uint8_t oneButtonEvents = OBM_CLICK | OBM_DOUBLECLICK | OBM_LONGPRESSSTART | OBM_LONGPRESSSTOP;
+  const uint8_t tinyEvents = OBM_CLICK | OBM_DOUBLECLICK | OBM_LONGPRESSSTART;
+  bool ok = true;
+
+  printf("%-14s %-12s %12s %10s %10s %8s %6s %6s\n", "class", "trace", "ticks/sec", "ns/tick", "cycles", "err(ms)", "missed", "extra");
+
+  for (const trace_t &trace : traces) {
+    result_t result;
+
+    measure<OneButton>(trace, oneButtonEvents, attachOneButton, result);
+    print("OneButton", trace, result);
+    ok = ok && !result.missed && !result.extra;
+
+    measure<OneButtonTiny>(trace, tinyEvents, attachTiny, result);
+    print("OneButtonTiny", trace, result);
+    ok = ok && !result.missed && !result.extra;
+  }
+
+  return ok ? 0 : 1;
+}
+
+// end.
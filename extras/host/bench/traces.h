@@ -0,0 +1,71 @@
+// -----
+// traces.h - Recorded input traces of a bouncing button for the host benchmarks.
+// A trace is a list of raw level changes with timestamps and the list of events
+// expected with the default timing (debounce 50, click 400, press 800 msecs).
+// The expected times are the ideal times computed from the last bounce of an edge.
+// -----
+
+#ifndef traces_h
+#define traces_h
+
+#include "OneButtonTypes.h"
+
+struct traceEdge_t {
+  unsigned long time;  // msecs
+  bool level;          // true = pressed
+};
+
+struct traceEvent_t {
+  oneButtonEvent_t event;
+  unsigned long time;  // ideal msecs
+};
+
+struct trace_t {
+  const char *name;
+  unsigned long duration;
+  const traceEdge_t *edges;
+  uint8_t edgeCount;
+  const traceEvent_t *events;
+  uint8_t eventCount;
+};
+
+// single click with a bouncing contact, release stable at 203.
+static const traceEdge_t clickEdges[] = {
+  { 100, true }, { 101, false }, { 102, true }, { 200, false }, { 201, true }, { 203, false }
+};
+static const traceEvent_t clickEvents[] = {
+  { OBE_CLICK, 203 + 50 + 400 }
+};
+
+// double click, second release stable at 382.
+static const traceEdge_t doubleEdges[] = {
+  { 100, true }, { 180, false }, { 181, true }, { 182, false }, { 300, true }, { 380, false }, { 381, true }, { 382, false }
+};
+static const traceEvent_t doubleEvents[] = {
+  { OBE_DOUBLECLICK, 382 + 50 }
+};
+
+// long press with bouncing contacts on press and release.
+static const traceEdge_t longEdges[] = {
+  { 100, true }, { 102, false }, { 103, true }, { 1600, false }, { 1601, true }, { 1602, false }
+};
+static const traceEvent_t longEvents[] = {
+  { OBE_LONGPRESSSTART, 103 + 50 + 800 }, { OBE_LONGPRESSSTOP, 1602 + 50 }
+};
+
+// short glitches that must not be detected as button press.
+static const traceEdge_t noiseEdges[] = {
+  { 100, true }, { 110, false }, { 300, true }, { 320, false }, { 500, true }, { 530, false }
+};
+
+#define TRACE(name, duration, edges, events) \
+  { name, duration, edges, sizeof(edges) / sizeof(edges[0]), events, sizeof(events) / sizeof(events[0]) }
+
+static const trace_t traces[] = {
+  TRACE("click", 1200, clickEdges, clickEvents),
+  TRACE("doubleclick", 1200, doubleEdges, doubleEvents),
+  TRACE("longpress", 2500, longEdges, longEvents),
+  { "noise", 1200, noiseEdges, sizeof(noiseEdges) / sizeof(noiseEdges[0]), NULL, 0 },
+};
+
+#endif
@@ -0,0 +1,60 @@
+/**
+ * @file replay.cpp
+ *
+ * @brief Replay a trace recorded by OneButtonTrace on a host computer and print
+ * the events detected by the OneButton state machine.
+ *
+ *   onebutton_replay trace.bin [debounceMs [clickMs [pressMs]]]
+ *
+ * This work is licensed under a BSD style license. See
+ * http://www.mathertel.de/License.aspx
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "OneButton.h"
+#include "OneButtonTrace.h"
+
+static const char *eventNames[] = { "press", "click", "doubleclick", "multiclick", "longpressstart", "longpressstop", "duringlongpress", "idle" };
+
+static void onEvent(OneButton *button, oneButtonEvent_t event, void *parameter) {
+  (void)parameter;
+  if (event == OBE_DURINGLONGPRESS) return;
+  printf("%8lu %-16s clicks=%d", button->getTickMs(), eventNames[event], button->getNumberClicks());
+  if ((event == OBE_LONGPRESSSTART) || (event == OBE_LONGPRESSSTOP)) printf(" pressed=%lu", button->getPressedMs());
+  printf("\n");
+}
+
+
+int main(int argc, char *argv[]) {
+  if (argc < 2) {
+    fprintf(stderr, "usage: %s trace.bin [debounceMs [clickMs [pressMs]]]\n", argv[0]);
+    return 2;
+  }
+
+  FILE *f = fopen(argv[1], "rb");
+  if (!f) {
+    perror(argv[1]);
+    return 2;
+  }
+  std::vector<uint8_t> data;
+  int c;
+  while ((c = fgetc(f)) != EOF) data.push_back((uint8_t)c);
+  fclose(f);
+
+  OneButton button;
+  if (argc > 2) button.setDebounceMs(atoi(argv[2]));
+  if (argc > 3) button.setClickMs(atoi(argv[3]));
+  if (argc > 4) button.setPressMs(atoi(argv[4]));
+  button.attachEvent(onEvent);
+
+  OneButtonTraceReplay trace(data.data(), data.size());
+  unsigned long endTime = trace.replay(button);
+
+  printf("%zu bytes replayed until %lu msecs\n", data.size(), endTime);
+  return 0;
+}
+
+// end.
@@ -0,0 +1,101 @@
+// -----
+// Arduino.h - Minimal Arduino API for building the OneButton library on a host computer.
+// The clock and the input pins are simulated and can be controlled or replaced
+// by the functions in the OneButtonHost namespace.
+// This work is licensed under a BSD style license. See
+// http://www.mathertel.de/License.aspx
+// -----
+// 14.10.2026 created for host side simulation and benchmarks.
+// -----
+
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define HIGH 0x1
+#define LOW 0x0
+
+#define INPUT 0x0
+#define OUTPUT 0x1
+#define INPUT_PULLUP 0x2
+
+#define CHANGE 1
+#define FALLING 2
+#define RISING 3
+
+#define F(s) (s)
+
+typedef uint8_t byte;
+
+template <class T>
+inline T max(const T a, const T b) {
+  return (a > b) ? a : b;
+}
+
+template <class T>
+inline T min(const T a, const T b) {
+  return (a < b) ? a : b;
+}
+
+unsigned long millis(void);
+unsigned long micros(void);
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+void pinMode(uint8_t pin, uint8_t mode);
+int digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t val);
+int analogRead(uint8_t pin);
+
+void noInterrupts(void);
+void interrupts(void);
+
+namespace OneButtonHost {
+
+// number of simulated pins.
+const uint8_t PIN_COUNT = 64;
+
+/**
+ * Set the simulated time in msecs. micros() is derived from it.
+ */
+void setMillis(unsigned long ms);
+
+/**
+ * Advance the simulated time.
+ */
+void advance(unsigned long ms);
+
+/**
+ * Set the level of a simulated digital input pin.
+ * A pin change interrupt attached to the pin is called.
+ */
+void setPin(uint8_t pin, int level);
+
+/**
+ * Set the value returned by analogRead() for a pin.
+ */
+void setAnalog(uint8_t pin, int value);
+
+/**
+ * Replace the simulated clock by a function, e.g. a real time clock for benchmarks.
+ * Pass NULL to use the simulated clock again.
+ */
+void setClock(unsigned long (*millisFunc)(void), unsigned long (*microsFunc)(void));
+
+/**
+ * Replace the simulated digital input pins by a function.
+ * Pass NULL to use the simulated pins again.
+ */
+void setPinReader(int (*readFunc)(uint8_t pin));
+
+/**
+ * @return the mode last set by pinMode() for a pin.
+ */
+uint8_t getPinMode(uint8_t pin);
+
+}  // namespace OneButtonHost
+
+#endif
@@ -0,0 +1,130 @@
+/**
+ * @file ArduinoHost.cpp
+ *
+ * @brief Simulated clock, pins and pin change interrupts for building the
+ * OneButton library on a host computer.
+ *
+ * This work is licensed under a BSD style license. See
+ * http://www.mathertel.de/License.aspx
+ */
+
+#include "Arduino.h"
+#include "PinChangeInterrupt.h"
+
+static unsigned long simMillis = 0;
+static int simLevel[OneButtonHost::PIN_COUNT];
+static int simAnalog[OneButtonHost::PIN_COUNT];
+static uint8_t simMode[OneButtonHost::PIN_COUNT];
+
+static void (*pcintFunc[OneButtonHost::PIN_COUNT])(void);
+static bool pcintEnabled[OneButtonHost::PIN_COUNT];
+
+static unsigned long (*clockMillis)(void) = NULL;
+static unsigned long (*clockMicros)(void) = NULL;
+static int (*pinReader)(uint8_t pin) = NULL;
+
+
+// ----- Arduino API -----
+
+unsigned long millis(void) {
+  return clockMillis ? clockMillis() : simMillis;
+}
+
+unsigned long micros(void) {
+  return clockMicros ? clockMicros() : simMillis * 1000UL;
+}
+
+void delay(unsigned long ms) {
+  OneButtonHost::advance(ms);
+}
+
+void delayMicroseconds(unsigned int us) {
+  (void)us;
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  if (pin < OneButtonHost::PIN_COUNT) simMode[pin] = mode;
+  // a pullup pin reads HIGH when nothing is connected.
+  if ((pin < OneButtonHost::PIN_COUNT) && (mode == INPUT_PULLUP)) simLevel[pin] = HIGH;
+}
+
+int digitalRead(uint8_t pin) {
+  if (pinReader) return pinReader(pin);
+  return (pin < OneButtonHost::PIN_COUNT) ? simLevel[pin] : LOW;
+}
+
+void digitalWrite(uint8_t pin, uint8_t val) {
+  OneButtonHost::setPin(pin, val);
+}
+
+int analogRead(uint8_t pin) {
+  return (pin < OneButtonHost::PIN_COUNT) ? simAnalog[pin] : 0;
+}
+
+void noInterrupts(void) {}
+void interrupts(void) {}
+
+
+// ----- PinChangeInterrupt API -----
+
+void attachPinChangeInterrupt(uint8_t pcintNum, void (*userFunc)(void), uint8_t mode) {
+  (void)mode;
+  if (pcintNum < OneButtonHost::PIN_COUNT) {
+    pcintFunc[pcintNum] = userFunc;
+    pcintEnabled[pcintNum] = true;
+  }
+}
+
+void detachPinChangeInterrupt(uint8_t pcintNum) {
+  if (pcintNum < OneButtonHost::PIN_COUNT) pcintFunc[pcintNum] = NULL;
+}
+
+void enablePinChangeInterrupt(uint8_t pcintNum) {
+  if (pcintNum < OneButtonHost::PIN_COUNT) pcintEnabled[pcintNum] = true;
+}
+
+void disablePinChangeInterrupt(uint8_t pcintNum) {
+  if (pcintNum < OneButtonHost::PIN_COUNT) pcintEnabled[pcintNum] = false;
+}
+
+
+// ----- Simulation control -----
+
+namespace OneButtonHost {
+
+void setMillis(unsigned long ms) {
+  simMillis = ms;
+}
+
+void advance(unsigned long ms) {
+  simMillis += ms;
+}
+
+void setPin(uint8_t pin, int level) {
+  if (pin >= PIN_COUNT) return;
+
+  bool changed = (simLevel[pin] != level);
+  simLevel[pin] = level;
+  if (changed && pcintEnabled[pin] && pcintFunc[pin]) pcintFunc[pin]();
+}
+
+void setAnalog(uint8_t pin, int value) {
+  if (pin < PIN_COUNT) simAnalog[pin] = value;
+}
+
+void setClock(unsigned long (*millisFunc)(void), unsigned long (*microsFunc)(void)) {
+  clockMillis = millisFunc;
+  clockMicros = microsFunc;
+}
+
+void setPinReader(int (*readFunc)(uint8_t pin)) {
+  pinReader = readFunc;
+}
+
+uint8_t getPinMode(uint8_t pin) {
+  return (pin < PIN_COUNT) ? simMode[pin] : INPUT;
+}
+
+}  // namespace OneButtonHost
+
+// end.
@@ -0,0 +1,19 @@
+// -----
+// PinChangeInterrupt.h - Simulated pin change interrupts for building the
+// OneButton library on a host computer.
+// The attached function is called by OneButtonHost::setPin() on a level change.
+// -----
+
+#ifndef PinChangeInterrupt_h
+#define PinChangeInterrupt_h
+
+#include "Arduino.h"
+
+#define digitalPinToPinChangeInterrupt(p) ((p) < OneButtonHost::PIN_COUNT ? (p) : 0xFF)
+
+void attachPinChangeInterrupt(uint8_t pcintNum, void (*userFunc)(void), uint8_t mode);
+void detachPinChangeInterrupt(uint8_t pcintNum);
+void enablePinChangeInterrupt(uint8_t pcintNum);
+void disablePinChangeInterrupt(uint8_t pcintNum);
+
+#endif
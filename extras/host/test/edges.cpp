@@ -0,0 +1,139 @@
+/**
+ * @file edges.cpp
+ *
+ * @brief Compare the events of a button using the edge capture mode of attachEdgeInterupt()
+ * with the events of a button polled every msec while both see the same bouncing input.
+ * The edge mode button only gets a tick() when its nextDeadlineMs() has passed,
+ * like a sketch sleeping between the timeouts.
+ *
+ * This work is licensed under a BSD style license. See
+ * http://www.mathertel.de/License.aspx
+ */
+
+#include <stdio.h>
+
+#include "OneButton.h"
+
+static const uint8_t POLL_PIN = 2;
+static const uint8_t EDGE_PIN = 3;
+
+// number of random gestures of a test run.
+static const int GESTURES = 400;
+
+// ----- event recording -----
+
+struct recorder_t {
+  oneButtonEvent_t events[8 * GESTURES];
+  int count;
+};
+
+static void record(OneButton *button, oneButtonEvent_t event, void *parameter) {
+  recorder_t *r = (recorder_t *)parameter;
+  if (r->count < 8 * GESTURES) r->events[r->count++] = event;
+}
+
+// ----- random bouncing input -----
+
+static unsigned long seed;
+
+static unsigned long randomMs(const unsigned long from, const unsigned long to) {
+  seed = seed * 1103515245UL + 12345UL;
+  return from + ((seed >> 8) % (to - from));
+}
+
+struct input_t {
+  unsigned long next;  // time of the next edge
+  bool pressed;        // the level after the debouncing
+  uint8_t bounces;     // edges left until the level is stable
+  bool level;          // raw level
+};
+
+// the next raw level change of the input, the gestures mix clicks, multi clicks and long presses.
+static void nextEdge(input_t &in, const unsigned long t) {
+  if (in.bounces) {
+    in.bounces--;
+    in.level = !in.level;
+    in.next = t + randomMs(1, in.bounces ? 4 : 2);
+    if (!in.bounces) in.level = in.pressed;
+    return;
+  }
+
+  in.pressed = !in.pressed;
+  in.level = in.pressed;
+  in.bounces = 2 * (uint8_t)randomMs(0, 3);
+  if (in.pressed) {
+    in.next = t + (randomMs(0, 4) ? randomMs(80, 300) : randomMs(900, 1800));
+  } else {
+    in.next = t + (randomMs(0, 3) ? randomMs(100, 300) : randomMs(500, 1500));
+  }
+  if (in.bounces) in.next = t + randomMs(1, 4);
+}
+
+static void setup(OneButton &button, recorder_t &recorder) {
+  recorder.count = 0;
+  button.attachEvent(record, &recorder);
+  button.setLongPressIntervalMs(100);
+}
+
+
+int main() {
+  bool ok = true;
+
+  for (unsigned long run = 1; run < 20; run++) {
+    seed = run;
+    OneButtonHost::setMillis(0);
+    OneButtonHost::setPin(POLL_PIN, HIGH);
+    OneButtonHost::setPin(EDGE_PIN, HIGH);
+
+    OneButton poll(POLL_PIN, true, false);
+    OneButton edge(EDGE_PIN, true, false);
+    static recorder_t pollEvents, edgeEvents;
+    setup(poll, pollEvents);
+    setup(edge, edgeEvents);
+    if (!edge.attachEdgeInterupt()) {
+      printf("attachEdgeInterupt() failed\n");
+      return 1;
+    }
+
+    input_t in = { 100, false, 0, false };
+    unsigned long wakeup = 0;
+    int gestures = 0;
+
+    for (unsigned long t = 0; gestures < GESTURES; t++) {
+      OneButtonHost::setMillis(t);
+      if ((long)(t - wakeup) >= 0) edge.tick();
+
+      // the edge interrupt happens after the tick() before going to sleep.
+      while (in.next == t) {
+        OneButtonHost::setPin(POLL_PIN, in.level ? LOW : HIGH);
+        OneButtonHost::setPin(EDGE_PIN, in.level ? LOW : HIGH);
+        if (!in.bounces && !in.pressed) gestures++;
+        nextEdge(in, t);
+      }
+      poll.tick();
+
+      unsigned long deadline = edge.nextDeadlineMs();
+      wakeup = t + ((deadline == ONEBUTTON_NO_DEADLINE) ? 0x40000000UL : deadline);
+    }
+
+    // let both buttons finish the last gesture.
+    unsigned long end = millis() + 3000;
+    for (unsigned long t = end - 3000; t < end; t++) {
+      OneButtonHost::setMillis(t);
+      if ((long)(t - wakeup) >= 0) edge.tick();
+      poll.tick();
+      unsigned long deadline = edge.nextDeadlineMs();
+      wakeup = t + ((deadline == ONEBUTTON_NO_DEADLINE) ? 0x40000000UL : deadline);
+    }
+
+    bool same = (pollEvents.count == edgeEvents.count);
+    for (int n = 0; same && (n < pollEvents.count); n++) same = (pollEvents.events[n] == edgeEvents.events[n]);
+    printf("seed %2lu: %4d polled events, %4d edge events %s\n", run, pollEvents.count, edgeEvents.count, same ? "ok" : "DIFFERENT");
+    ok = ok && same;
+    edge.detachInterupt();
+  }
+
+  return ok ? 0 : 1;
+}
+
+// end.
@@ -0,0 +1,76 @@
+/**
+ * @file latetick.cpp
+ *
+ * @brief Check that a button in edge capture mode reports the same events when tick() is called
+ * long after the edges: a click timeout that passed before a new press became stable must
+ * report a click and not count the new press into a double click.
+ *
+ * This work is licensed under a BSD style license. See
+ * http://www.mathertel.de/License.aspx
+ */
+
+#include <stdio.h>
+
+#include "OneButton.h"
+
+static const uint8_t PIN = 2;
+
+static int clicks = 0;
+static int doubleClicks = 0;
+
+static void onClick() {
+  clicks++;
+}
+static void onDoubleClick() {
+  doubleClicks++;
+}
+
+struct step_t {
+  unsigned long time;
+  int level;  // -1: only tick()
+};
+
+// click, a new press 10 msecs before the click timeout, a tick() while it is bouncing and
+// the next tick() after the click timeout and after the new press became stable.
+static const step_t steps[] = {
+  { 100, LOW }, { 250, HIGH }, { 260, -1 },
+  { 690, LOW }, { 692, HIGH }, { 694, LOW }, { 696, -1 },
+  { 900, -1 }, { 1000, HIGH }, { 3000, -1 }
+};
+
+
+static bool run(const bool late) {
+  OneButtonHost::setMillis(0);
+  OneButtonHost::setPin(PIN, HIGH);
+  clicks = doubleClicks = 0;
+
+  OneButton button(PIN, true, false);
+  button.attachClick(onClick);
+  button.attachDoubleClick(onDoubleClick);
+  button.attachEdgeInterupt();
+
+  uint8_t n = 0;
+  for (unsigned long t = 0; t <= 3000; t++) {
+    OneButtonHost::setMillis(t);
+    while ((n < sizeof(steps) / sizeof(steps[0])) && (steps[n].time == t)) {
+      if (steps[n].level >= 0) OneButtonHost::setPin(PIN, steps[n].level);
+      if (late && (steps[n].level < 0)) button.tick();
+      n++;
+    }
+    if (!late) button.tick();
+  }
+  button.detachInterupt();
+
+  bool ok = (clicks == 2) && (doubleClicks == 0);
+  printf("%-8s tick(): %d clicks, %d double clicks %s\n", late ? "late" : "every", clicks, doubleClicks, ok ? "ok" : "WRONG");
+  return ok;
+}
+
+
+int main() {
+  bool ok = run(false);
+  ok = run(true) && ok;
+  return ok ? 0 : 1;
+}
+
+// end.
@@ -18,16 +18,24 @@
 
 #include "OneButton.h"
 
+#if ONEBUTTON_TRACE
+#include "OneButtonTrace.h"
+#endif
+
 // ----- Initialization and Default Values -----
 
-void (*OneButton::isrCallback)() = OneButton::isrDefaultUnused;
 void OneButton::isrDefaultUnused(){/*NOP*/};
+
+static_assert((ONEBUTTON_EDGE_SLOTS >= 1) && (ONEBUTTON_EDGE_SLOTS <= 8), "ONEBUTTON_EDGE_SLOTS must be 1..8");
+static_assert((ONEBUTTON_EDGE_BUFFER == 2) || (ONEBUTTON_EDGE_BUFFER == 4) || (ONEBUTTON_EDGE_BUFFER == 8), "ONEBUTTON_EDGE_BUFFER must be 2, 4 or 8");
+
+OneButton::edgeSlot_t OneButton::_edgeSlots[ONEBUTTON_EDGE_SLOTS];
+
 /**
  * @brief Construct a new OneButton object but not (yet) initialize the IO pin.
  */
 OneButton::OneButton() {
   _pin = -1;
-  isrCallback =  isrDefaultUnused;
   _mode = CHANGE;
   // further initialization has moved to OneButton.h
 }
@@ -35,7 +43,6 @@ OneButton::OneButton() {
 // Initialize the OneButton library.
 OneButton::OneButton(const int pin, const bool activeLow, const bool pullupActive) {
   setup(pin, pullupActive ? INPUT_PULLUP : INPUT, activeLow);
-  isrCallback =  isrDefaultUnused;
   _mode = CHANGE;
 }  // OneButton
 
@@ -62,6 +69,13 @@ void OneButton::setDebounceMs(const int ms) {
 }  // setDebounceMs
 
 
+void OneButton::setDebounceMode(const uint8_t mode) {
+  _debounceMode = mode;
+  // start the integrator at the rail of the debounced level.
+  _integral = debouncedLevel ? _time(abs(_debounce_ms)) : 0;
+}  // setDebounceMode
+
+
 // explicitly set the number of millisec that have to pass by before a click is detected.
 void OneButton::setClickMs(const unsigned int ms) {
   _click_ms = ms;
@@ -78,9 +92,19 @@ void OneButton::setIdleMs(const unsigned int ms) {
   _idle_ms = ms;
 }  // setIdleMs
 
-void OneButton::attachInterupt(uint8_t mode,void (*userFunc)(void)) {
-  attachPinChangeInterrupt(digitalPinToPinChangeInterrupt(_pin), userFunc, mode);
-  isrCallback =  userFunc;
+// bind a library owned ISR to this instance, it marks the button as changed and calls the user function.
+void OneButton::attachInterupt(uint8_t mode, void (*userFunc)(void)) {
+  // this replaces the edge capture by attachEdgeInterupt(), the edges of attachEdgeCapture() are kept.
+  if ((_isrSlot != OneButtonIsr::NO_SLOT) && (OneButtonIsr::handler(_isrSlot) == _edgeHandler)) _releaseEdgeSlot();
+
+  _isrSlot = OneButtonIsr::attach(NULL, this, (userFunc == isrDefaultUnused) ? NULL : userFunc);
+
+  if (_isrSlot == OneButtonIsr::NO_SLOT) {
+    // all slots are used: call the user function directly, tick() reads the pin every time.
+    attachPinChangeInterrupt(digitalPinToPinChangeInterrupt(_pin), userFunc, mode);
+  } else {
+    attachPinChangeInterrupt(digitalPinToPinChangeInterrupt(_pin), OneButtonIsr::isr(_isrSlot), mode);
+  }
   _mode = mode;
 }
 
@@ -92,6 +116,133 @@ void OneButton::disableInterupt(uint8_t mode, void (*userFunc)(void)) {
   disablePinChangeInterrupt(digitalPinToPinChangeInterrupt(_pin)); 
 }
 
+// release the library owned ISR and the edge slot so other buttons can use them.
+void OneButton::detachInterupt() {
+  if (_pin >= 0) detachPinChangeInterrupt(digitalPinToPinChangeInterrupt(_pin));
+  OneButtonIsr::detach(_isrSlot);
+  _isrSlot = OneButtonIsr::NO_SLOT;
+  _releaseEdgeSlot();
+}  // detachInterupt()
+
+
+// use a free edge slot and register the library owned ISR for it.
+bool OneButton::attachEdgeInterupt() {
+  if (_pin < 0) return false;
+
+  if (_edgeSlot == NO_EDGE_SLOT) {
+    uint8_t n = _freeEdgeSlot();
+    if (n == NO_EDGE_SLOT) return false;
+
+    _isrSlot = OneButtonIsr::attach(_edgeHandler, this, NULL);
+    if (_isrSlot == OneButtonIsr::NO_SLOT) return false;
+
+    _useEdgeSlot(n);
+    attachPinChangeInterrupt(digitalPinToPinChangeInterrupt(_pin), OneButtonIsr::isr(_isrSlot), CHANGE);
+    _mode = CHANGE;
+  }
+  return true;
+}  // attachEdgeInterupt()
+
+
+// use a free edge slot that is filled by an external capture ISR.
+bool OneButton::attachEdgeCapture() {
+  if (_pin < 0) return false;
+
+  if (_edgeSlot == NO_EDGE_SLOT) {
+    uint8_t n = _freeEdgeSlot();
+    if (n == NO_EDGE_SLOT) return false;
+    _useEdgeSlot(n);
+  }
+  return true;
+}  // attachEdgeCapture()
+
+
+// find an unused edge slot.
+uint8_t OneButton::_freeEdgeSlot() {
+  uint8_t n = 0;
+  while ((n < ONEBUTTON_EDGE_SLOTS) && _edgeSlots[n].button) n++;
+  return (n == ONEBUTTON_EDGE_SLOTS) ? NO_EDGE_SLOT : n;
+}  // _freeEdgeSlot()
+
+
+// bind the edge slot to this button.
+void OneButton::_useEdgeSlot(const uint8_t n) {
+  edgeSlot_t &slot = _edgeSlots[n];
+  slot.head = slot.tail = 0;
+  slot.button = this;
+  _edgeSlot = n;
+
+  // seed the buffer with the current level, the pin may already be pressed.
+  captureEdge();
+}  // _useEdgeSlot()
+
+
+// unbind the edge slot from this button, the pin is read by tick() again.
+void OneButton::_releaseEdgeSlot() {
+  if (_edgeSlot == NO_EDGE_SLOT) return;
+
+  noInterrupts();
+  _edgeSlots[_edgeSlot].button = NULL;
+  _edgeSlot = NO_EDGE_SLOT;
+  interrupts();
+}  // _releaseEdgeSlot()
+
+
+// the ISR handler of the edge capture mode.
+void OneButton::_edgeHandler(void *context) {
+  ((OneButton *)context)->captureEdge();
+}  // _edgeHandler()
+
+
+// store the current level and time in the ring buffer, runs in interrupt context.
+void OneButton::captureEdge() {
+  if (_edgeSlot == NO_EDGE_SLOT) return;
+  captureEdge(digitalRead(_pin), millis());
+}  // captureEdge()
+
+
+// store the given level and time in the ring buffer, runs in interrupt context.
+void OneButton::captureEdge(const int pinLevel, const unsigned long ms) {
+  if (_edgeSlot == NO_EDGE_SLOT) return;
+
+  edgeSlot_t &slot = _edgeSlots[_edgeSlot];
+  uint8_t head = slot.head;
+
+  if ((uint8_t)(head - slot.tail) == ONEBUTTON_EDGE_BUFFER) {
+    // buffer is full: overwrite the newest entry so the latest level is never lost.
+    head--;
+  }
+  uint8_t n = head & (ONEBUTTON_EDGE_BUFFER - 1);
+  slot.time[n] = _time(ms);
+  if (pinLevel == _buttonPressed) {
+    slot.levels |= (1 << n);
+  } else {
+    slot.levels &= ~(1 << n);
+  }
+  slot.head = head + 1;
+}  // captureEdge()
+
+// save function for all events
+bool OneButton::attachEvent(eventCallbackFunction newFunction, void *parameter) {
+  // keep the function of another consumer.
+  if (newFunction && _eventFunc && ((newFunction != _eventFunc) || (parameter != _eventParam))) return false;
+
+  _eventFunc = newFunction;
+  _eventParam = parameter;
+  _maxClicks = max(_maxClicks, (uint8_t)100);
+  return true;
+}  // attachEvent
+
+
+// enable the events that are only detected when requested.
+void OneButton::setPollEvents(const uint8_t mask) {
+  _pollEvents = mask;
+  if (mask & OBM_DOUBLECLICK) _maxClicks = max(_maxClicks, (uint8_t)2);
+  if (mask & OBM_MULTICLICK) _maxClicks = max(_maxClicks, (uint8_t)100);
+}  // setPollEvents
+
+
+#if !ONEBUTTON_COMPACT_CALLBACKS
 // save function for click event
 void OneButton::attachPress(callbackFunction newFunction) {
   _pressFunc = newFunction;
@@ -120,7 +271,7 @@ void OneButton::attachClick(parameterizedCallbackFunction newFunction, void *par
 // save function for doubleClick event
 void OneButton::attachDoubleClick(callbackFunction newFunction) {
   _doubleClickFunc = newFunction;
-  _maxClicks = max(_maxClicks, 2);
+  _maxClicks = max(_maxClicks, (uint8_t)2);
 }  // attachDoubleClick
 
 
@@ -128,14 +279,14 @@ void OneButton::attachDoubleClick(callbackFunction newFunction) {
 void OneButton::attachDoubleClick(parameterizedCallbackFunction newFunction, void *parameter) {
   _paramDoubleClickFunc = newFunction;
   _doubleClickFuncParam = parameter;
-  _maxClicks = max(_maxClicks, 2);
+  _maxClicks = max(_maxClicks, (uint8_t)2);
 }  // attachDoubleClick
 
 
 // save function for multiClick event
 void OneButton::attachMultiClick(callbackFunction newFunction) {
   _multiClickFunc = newFunction;
-  _maxClicks = max(_maxClicks, 100);
+  _maxClicks = max(_maxClicks, (uint8_t)100);
 }  // attachMultiClick
 
 
@@ -143,7 +294,7 @@ void OneButton::attachMultiClick(callbackFunction newFunction) {
 void OneButton::attachMultiClick(parameterizedCallbackFunction newFunction, void *parameter) {
   _paramMultiClickFunc = newFunction;
   _multiClickFuncParam = parameter;
-  _maxClicks = max(_maxClicks, 100);
+  _maxClicks = max(_maxClicks, (uint8_t)100);
 }  // attachMultiClick
 
 
@@ -192,11 +343,23 @@ void OneButton::attachIdle(callbackFunction newFunction) {
 }  // attachIdle
 
 
+// save function for parameterized idle button event
+void OneButton::attachIdle(parameterizedCallbackFunction newFunction, void *parameter) {
+  _paramIdleFunc = newFunction;
+  _idleFuncParam = parameter;
+}  // attachIdle
+#endif
+
+
 void OneButton::reset(void) {
   _state = OneButton::OCS_INIT;
   _nClicks = 0;
-  _startTime = millis();
+  _startTime = _time(millis());
+#if ONEBUTTON_TIME_16
+  _pressWraps = 0;
+#endif
   _idleState = false;
+  _repeatCount = 0;
 }
 
 
@@ -206,20 +369,78 @@ int OneButton::getNumberClicks(void) {
 }
 
 
+// find the earliest time-based transition of the debouncer and the FSM.
+unsigned long OneButton::nextDeadlineMs() const {
+  onebutton_time_t t = _time(millis());
+  unsigned long deadline = ONEBUTTON_NO_DEADLINE;
+
+  if ((_edgeSlot != NO_EDGE_SLOT) && (_edgeSlots[_edgeSlot].head != _edgeSlots[_edgeSlot].tail)) {
+    // captured edges are waiting to be replayed by tick().
+    return 0;
+  }
+
+  if (debouncedLevel != _lastDebounceLevel) {
+    // a level change is waiting to become stable.
+    deadline = fsm_t::remainingMs(_lastDebounceTime, _debounceWait(), t);
+  }
+
+  deadline = min(deadline, fsm_t::nextDeadlineMs(*this, t));
+  return deadline;
+}  // nextDeadlineMs()
+
+
 /**
  * @brief Debounce input pin level for use in SpesialInput.
  */
 bool OneButton::debounce(const bool value) {
-  now = millis();  // current (relative) time in msecs.
+  now = _time(millis());  // current (relative) time in msecs.
+  return _debounce(value);
+}
+
+
+/**
+ * @brief Debounce the input level using the time already stored in `now`.
+ */
+bool OneButton::_debounce(const bool value) {
+#if ONEBUTTON_TRACE
+  if (_trace && (_lastDebounceLevel != value)) _trace->record(value, now);
+#endif
+
+  if (_debounceMode == OBD_INTEGRATOR) return _integrate(value);
+
+  if (_debounceMode == OBD_LOCKOUT) {
+    // accept a change immediately when the last change is longer ago than the debounce time.
+    _lastDebounceLevel = value;
+    if ((debouncedLevel != value) && ((onebutton_time_t)(now - _lastDebounceTime) >= _time(abs(_debounce_ms)))) {
+#if __ONEBTN_STATS__
+      _statsEdgeTime = now;
+#endif
+      debouncedLevel = value;
+      _lastDebounceTime = now;
+    }
+    return debouncedLevel;
+  }
 
   // Don't debounce going into active state, if _debounce_ms is negative
-  if (value && _debounce_ms < 0)
+  if (value && _debounce_ms < 0) {
+#if __ONEBTN_STATS__
+    if (!debouncedLevel) _statsEdgeTime = (_lastDebounceLevel == value) ? _lastDebounceTime : now;
+#endif
     debouncedLevel = value;
+  }
 
   if (_lastDebounceLevel == value) {
-    if (now - _lastDebounceTime >= abs(_debounce_ms))
+    if ((onebutton_time_t)(now - _lastDebounceTime) >= _time(abs(_debounce_ms))) {
+#if __ONEBTN_STATS__
+      if (debouncedLevel != value) _statsEdgeTime = _lastDebounceTime;
+#endif
       debouncedLevel = value;
+    }
   } else {
+#if __ONEBTN_STATS__
+    // the last raw level was not stable long enough.
+    if (_lastDebounceLevel != debouncedLevel) _stats.debounceRejects++;
+#endif
     _lastDebounceTime = now;
     _lastDebounceLevel = value;
   }
@@ -227,142 +448,274 @@ bool OneButton::debounce(const bool value) {
 };
 
 
+/**
+ * @brief Debounce the input level by integrating the time of the raw levels.
+ * A noise pulse only reduces the sum by its length instead of restarting the debounce time.
+ */
+bool OneButton::_integrate(const bool value) {
+  onebutton_time_t limit = _time(abs(_debounce_ms));
+  onebutton_time_t elapsed = now - _lastDebounceTime;
+
+  // the previous raw level was valid since the last sample.
+  if (_lastDebounceLevel) {
+    _integral = (elapsed >= (onebutton_time_t)(limit - min(_integral, limit))) ? limit : (onebutton_time_t)(_integral + elapsed);
+  } else {
+    _integral = (elapsed >= _integral) ? 0 : (onebutton_time_t)(_integral - elapsed);
+  }
+  _lastDebounceTime = now;
+  _lastDebounceLevel = value;
+
+  if ((limit == 0) || (_integral == 0) || (_integral == limit)) {
+    bool level = (limit == 0) ? value : (_integral == limit);
+#if __ONEBTN_STATS__
+    if (debouncedLevel != level) _statsEdgeTime = now - limit;
+#endif
+    debouncedLevel = level;
+  }
+  return debouncedLevel;
+}  // _integrate()
+
+
+#if __ONEBTN_STATS__
+void OneButton::resetStats() {
+  memset(&_stats, 0, sizeof(_stats));
+}  // resetStats()
+
+
+void OneButton::_countTick(const unsigned long startUs) {
+  unsigned long duration = micros() - startUs;
+
+  if ((_stats.ticks == 0) || (duration < _stats.minTickUs)) _stats.minTickUs = duration;
+  if (duration > _stats.maxTickUs) _stats.maxTickUs = duration;
+  _stats.sumTickUs += duration;
+  _stats.ticks++;
+}  // _countTick()
+#endif
+
+
 /**
  * @brief Check input of the configured pin,
  * debounce button state and then
  * advance the finite state machine (FSM).
  */
-void OneButton::tick(void) {
-  if (_pin >= 0) {
-    _fsm(debounce(digitalRead(_pin) == _buttonPressed));
+uint8_t OneButton::tick(void) {
+#if __ONEBTN_STATS__
+  unsigned long startUs = micros();
+#endif
+  _events = 0;
+
+  if (_edgeSlot != NO_EDGE_SLOT) {
+    _tickEdges();
+
+  } else if (_pin >= 0) {
+    // with a bound ISR a resting button without a pin change needs no work.
+    if ((_isrSlot == OneButtonIsr::NO_SLOT) || OneButtonIsr::takePending(_isrSlot) || !_isResting()) {
+      _fsm(debounce(digitalRead(_pin) == _buttonPressed));
+    }
   }
+
+#if __ONEBTN_STATS__
+  _countTick(startUs);
+#endif
+  return _events;
 }  // tick()
 
 
-void OneButton::tick(bool activeLevel) {
-  _fsm(debounce(activeLevel));
+uint8_t OneButton::tick(bool activeLevel) {
+  return tick(activeLevel, millis());
+}
+
+
+uint8_t OneButton::tick(bool activeLevel, unsigned long ms) {
+#if __ONEBTN_STATS__
+  unsigned long startUs = micros();
+#endif
+
+  _events = 0;
+  now = _time(ms);
+  _fsm(_debounce(activeLevel));
+
+#if __ONEBTN_STATS__
+  _countTick(startUs);
+#endif
+  return _events;
 }
 
 
 /**
- *  @brief Advance to a new state and save the last one to come back in cas of bouncing detection.
+ * @brief Replay the captured edges with their timestamps and
+ * advance the FSM by the current time only while it is not resting.
  */
-void OneButton::_newState(stateMachine_t nextState) {
-  _state = nextState;
-}  // _newState()
+void OneButton::_tickEdges() {
+  edgeSlot_t &slot = _edgeSlots[_edgeSlot];
+
+  while (slot.tail != slot.head) {
+    uint8_t n = slot.tail & (ONEBUTTON_EDGE_BUFFER - 1);
+    onebutton_time_t edgeTime = slot.time[n];
+    bool level = slot.levels & (1 << n);
+    slot.tail++;
+
+    // the previous level became stable before this edge: advance the FSM at that time.
+    _advanceStable(edgeTime);
+    _advanceTimeouts(edgeTime);
+
+    // the previous level was valid until this edge, then start debouncing the new level.
+    now = edgeTime;
+    _fsm(_debounce(_lastDebounceLevel));
+    _fsm(_debounce(level));
+  }
+
+  if (!_isResting()) {
+    onebutton_time_t t = _time(millis());
+    _advanceStable(t);
+    _advanceTimeouts(t);
+    now = t;
+    _fsm(_debounce(_lastDebounceLevel));
+  }
+}  // _tickEdges()
 
 
 /**
- * @brief Run the finite state machine (FSM) using the given level.
+ * @brief Advance the FSM at the time the last captured level became stable when this is before `time`
+ * so the events do not depend on the time tick() is called.
  */
-void OneButton::_fsm(bool activeLevel) {
-  unsigned long waitTime = (now - _startTime);
-
-  // Implementation of the state machine
-  switch (_state) {
-    case OneButton::OCS_INIT:
-      // on idle for idle_ms call idle function
-      if (!_idleState and (waitTime > _idle_ms))
-        if (_idleFunc) {
-          _idleState = true;
-          _idleFunc();
-        }
-
-      // waiting for level to become active.
-      if (activeLevel) {
-        _newState(OneButton::OCS_DOWN);
-        _startTime = now;  // remember starting time
-        _nClicks = 0;
-
-        if (_pressFunc) _pressFunc();
-        if (_paramPressFunc) _paramPressFunc(_pressFuncParam);
-      }  // if
-      break;
+void OneButton::_advanceStable(const onebutton_time_t time) {
+  onebutton_time_t stableTime = _lastDebounceTime + _debounceWait();
+
+  if ((debouncedLevel != _lastDebounceLevel) && ((onebutton_timediff_t)(time - stableTime) > 0)) {
+    // the timeouts before this time still see the previous level.
+    _advanceTimeouts(stableTime);
+    now = stableTime;
+    _fsm(_debounce(_lastDebounceLevel));
+    // leave the transient states at the same time.
+    if ((_state == OCS_UP) || (_state == OCS_PRESSEND)) _fsm(_debounce(_lastDebounceLevel));
+  }
+}  // _advanceStable()
 
-    case OneButton::OCS_DOWN:
-      // waiting for level to become inactive.
 
-      if (!activeLevel) {
-        _newState(OneButton::OCS_UP);
-        _startTime = now;  // remember starting time
+/**
+ * @brief Run the FSM at the times of its timeouts that are before `time` using the debounced level,
+ * e.g. a click timeout before a new press that is replayed later.
+ */
+void OneButton::_advanceTimeouts(const onebutton_time_t time) {
+  for (;;) {
+    unsigned long deadline = fsm_t::nextDeadlineMs(*this, now);
+    // DuringLongPress without interval is only reported once per tick().
+    if ((deadline == ONEBUTTON_NO_DEADLINE) || ((_state == OCS_PRESS) && !_fsmDuringInterval())) break;
+
+    // a state without timeout is left by the next tick like in polling mode.
+    onebutton_time_t deadlineTime = now + max(_time(deadline), (onebutton_time_t)1);
+    if ((onebutton_timediff_t)(time - deadlineTime) <= 0) break;
+    now = deadlineTime;
+    _fsm(debouncedLevel);
+  }
+}  // _advanceTimeouts()
+
 
-      } else if (waitTime > _press_ms) {
-        if (_longPressStartFunc) _longPressStartFunc();
-        if (_paramLongPressStartFunc) _paramLongPressStartFunc(_longPressStartFuncParam);
-        _newState(OneButton::OCS_PRESS);
-      }  // if
+/**
+ * @brief Call the functions attached for the event.
+ */
+void OneButton::_fire(const oneButtonEvent_t event) {
+#if __ONEBTN_STATS__
+  unsigned long latency = _ms((onebutton_time_t)(now - _statsEdgeTime));
+  if (latency > _stats.maxLatencyMs) _stats.maxLatencyMs = latency;
+  _stats.sumLatencyMs += latency;
+  _stats.events++;
+#endif
+
+  _events |= (uint8_t)(1 << event);
+
+#if !ONEBUTTON_COMPACT_CALLBACKS
+  switch (event) {
+    case OBE_PRESS:
+      if (_pressFunc) _pressFunc();
+      if (_paramPressFunc) _paramPressFunc(_pressFuncParam);
       break;
 
-    case OneButton::OCS_UP:
-      // level is inactive
+    case OBE_CLICK:
+      if (_clickFunc) _clickFunc();
+      if (_paramClickFunc) _paramClickFunc(_clickFuncParam);
+      break;
 
-      // count as a short button down
-      _nClicks++;
-      _newState(OneButton::OCS_COUNT);
+    case OBE_DOUBLECLICK:
+      if (_doubleClickFunc) _doubleClickFunc();
+      if (_paramDoubleClickFunc) _paramDoubleClickFunc(_doubleClickFuncParam);
       break;
 
-    case OneButton::OCS_COUNT:
-      // dobounce time is over, count clicks
+    case OBE_MULTICLICK:
+      if (_multiClickFunc) _multiClickFunc();
+      if (_paramMultiClickFunc) _paramMultiClickFunc(_multiClickFuncParam);
+      break;
 
-      if (activeLevel) {
-        // button is down again
-        _newState(OneButton::OCS_DOWN);
-        _startTime = now;  // remember starting time
+    case OBE_LONGPRESSSTART:
+      if (_longPressStartFunc) _longPressStartFunc();
+      if (_paramLongPressStartFunc) _paramLongPressStartFunc(_longPressStartFuncParam);
+      break;
 
-      } else if ((waitTime >= _click_ms) || (_nClicks == _maxClicks)) {
-        // now we know how many clicks have been made.
+    case OBE_LONGPRESSSTOP:
+      if (_longPressStopFunc) _longPressStopFunc();
+      if (_paramLongPressStopFunc) _paramLongPressStopFunc(_longPressStopFuncParam);
+      break;
 
-        if (_nClicks == 1) {
-          // this was 1 click only.
-          if (_clickFunc) _clickFunc();
-          if (_paramClickFunc) _paramClickFunc(_clickFuncParam);
+    case OBE_DURINGLONGPRESS:
+      if (_duringLongPressFunc) _duringLongPressFunc();
+      if (_paramDuringLongPressFunc) _paramDuringLongPressFunc(_duringLongPressFuncParam);
+      break;
 
-        } else if (_nClicks == 2) {
-          // this was a 2 click sequence.
-          if (_doubleClickFunc) _doubleClickFunc();
-          if (_paramDoubleClickFunc) _paramDoubleClickFunc(_doubleClickFuncParam);
+    case OBE_IDLE:
+      if (_idleFunc) _idleFunc();
+      if (_paramIdleFunc) _paramIdleFunc(_idleFuncParam);
+      break;
+  }  // switch
+#endif
 
-        } else {
-          // this was a multi click sequence.
-          if (_multiClickFunc) _multiClickFunc();
-          if (_paramMultiClickFunc) _paramMultiClickFunc(_multiClickFuncParam);
-        }  // if
+  if (_eventFunc) _eventFunc(this, event, _eventParam);
+}  // _fire()
 
-        reset();
-      }  // if
-      break;
 
-    case OneButton::OCS_PRESS:
-      // waiting for pin being release after long press.
+// count the repeats and take the interval to the next repeat from the table.
+void OneButton::_repeat(const oneButtonEvent_t event) {
+  if (event == OBE_LONGPRESSSTART) {
+    _repeatCount = 0;
+    if (_repeatTable) {
+      // the delay to the first repeat starts now.
+      _lastDuringLongPressTime = now;
+      _repeatIntervalMs = _repeatDelayMs;
+    }
 
-      if (!activeLevel) {
-        _newState(OneButton::OCS_PRESSEND);
+  } else {
+    if (_repeatCount < 0xFFFF) _repeatCount++;
+    if (_repeatTable) {
+      uint16_t n = _repeatCount - 1;  // number of intervals since the first repeat
+      uint8_t step = 0;
+      while ((step + 1 < _repeatSteps) && (n >= _repeatTable[step].count)) {
+        n -= _repeatTable[step].count;
+        step++;
+      }
+      _repeatIntervalMs = _repeatTable[step].intervalMs;
+    }
+  }
+}  // _repeat()
 
-      } else {
-        // still the button is pressed
-        if ((now - _lastDuringLongPressTime) >= _long_press_interval_ms) {
-          if (_duringLongPressFunc) _duringLongPressFunc();
-          if (_paramDuringLongPressFunc) _paramDuringLongPressFunc(_duringLongPressFuncParam);
-          _lastDuringLongPressTime = now;
-        }
-      }  // if
-      break;
 
-    case OneButton::OCS_PRESSEND:
-      // button was released.
+/**
+ *  @brief Advance to a new state and save the last one to come back in cas of bouncing detection.
+ */
+void OneButton::_newState(stateMachine_t nextState) {
+  _state = nextState;
+}  // _newState()
 
-      if (_longPressStopFunc) _longPressStopFunc();
-      if (_paramLongPressStopFunc) _paramLongPressStopFunc(_longPressStopFuncParam);
-      reset();
-      break;
 
-    default:
-      // unknown state detected -> reset state machine
-      _newState(OneButton::OCS_INIT);
-      break;
-  }  // if
+/**
+ * @brief Run the finite state machine (FSM) using the given level.
+ */
+void OneButton::_fsm(bool activeLevel) {
+#if __ONEBTN_STATS__
+  _stats.stateTicks[_state & 0x07]++;
+#endif
 
-}  // OneButton.tick()
+  fsm_t::run(*this, activeLevel, now);
+}  // _fsm()
 
 
 // end.
@@ -20,6 +20,24 @@
 // 26.09.2018 Jay M Ericsson: compiler warnings removed.
 // 29.01.2020 improvements from ShaggyDog18
 // 07.05.2023 Debouncing in one point. #118
+// 14.10.2026 Interrupt driven edge capture mode.
+// 14.10.2026 nextDeadlineMs() added for sleeping until the next timeout.
+// 14.10.2026 Event dispatcher and compact callback layout.
+// 14.10.2026 Optional statistics by __ONEBTN_STATS__.
+// 14.10.2026 tick(level, now) with a time sampled once per scan.
+// 14.10.2026 attachInterupt() binds the interrupt to the instance.
+// 14.10.2026 wantsFastTick() for adaptive tick rates.
+// 14.10.2026 Optional 16 bit timebase by ONEBUTTON_TIME_16.
+// 14.10.2026 tick() returns the mask of the detected events for polling.
+// 14.10.2026 Edges with timestamps from hardware input capture.
+// 14.10.2026 isInteruptAttached() for the power manager.
+// 14.10.2026 Optional trace of the raw level changes by ONEBUTTON_TRACE.
+// 14.10.2026 setDebounceMode() with integrator and lockout debouncing.
+// 14.10.2026 state machine shared with the other button classes, see OneButtonFsm.
+// 14.10.2026 auto repeat with a table driven acceleration for the DuringLongPress event.
+// 14.10.2026 member function callbacks by OneButtonDelegate.
+// 14.10.2026 attachEvent() keeps the function of another consumer.
+// 14.10.2026 detachInterupt() releases the interrupt slots.
 // -----
 
 #ifndef OneButton_h
@@ -27,6 +45,9 @@
 
 #include <Arduino.h>
 #include <PinChangeInterrupt.h>
+#include "OneButtonTypes.h"
+#include "OneButtonFsm.h"
+#include "OneButtonIsr.h"
 
 
 // Per-library debug control for OneButton.
@@ -45,12 +66,81 @@
 #define ONEBTN_DEBUG_PRINT(...)
 #endif
 
-// ----- Callback function types -----
+// Per-library statistics control for OneButton.
+// Set __ONEBTN_STATS__ to 1 to measure tick durations, state and debounce counters and event latencies.
+#ifndef __ONEBTN_STATS__
+#define __ONEBTN_STATS__ 0
+#endif
+
+// Set ONEBUTTON_TRACE to 1 to record the raw level changes by attachTrace(), see OneButtonTrace.h.
+// The setting must be the same for the library and the sketch so use a build flag.
+#ifndef ONEBUTTON_TRACE
+#define ONEBUTTON_TRACE 0
+#endif
 
-extern "C" {
-  typedef void (*callbackFunction)(void);
-  typedef void (*parameterizedCallbackFunction)(void *);
-}
+// Edge capture configuration for attachEdgeInterupt().
+// ONEBUTTON_EDGE_SLOTS is the number of buttons that can use edge capture (1..8), see also ONEBUTTON_ISR_SLOTS.
+// ONEBUTTON_EDGE_BUFFER is the number of edges buffered per button between 2 tick() calls (2, 4 or 8).
+#ifndef ONEBUTTON_EDGE_SLOTS
+#define ONEBUTTON_EDGE_SLOTS 4
+#endif
+
+#ifndef ONEBUTTON_EDGE_BUFFER
+#define ONEBUTTON_EDGE_BUFFER 4
+#endif
+
+// Set ONEBUTTON_COMPACT_CALLBACKS to 1 to remove the callback pointers of the single events.
+// All events are reported by the function given to attachEvent() then.
+// The setting must be the same for the library and the sketch so use a build flag.
+#ifndef ONEBUTTON_COMPACT_CALLBACKS
+#define ONEBUTTON_COMPACT_CALLBACKS 0
+#endif
+
+// Set ONEBUTTON_TIME_16 to 1 to store the timestamps in 16 bits for faster and smaller code on 8 bit processors.
+// The resolution is 2^ONEBUTTON_TIME_SHIFT msecs (default 4 msecs) giving a range of 262 secs for the timeouts.
+// Longer presses are reported correctly by getPressedMs() as long as tick() is called.
+// The setting must be the same for the library and the sketch so use a build flag.
+#ifndef ONEBUTTON_TIME_16
+#define ONEBUTTON_TIME_16 0
+#endif
+
+#if ONEBUTTON_TIME_16
+#ifndef ONEBUTTON_TIME_SHIFT
+#define ONEBUTTON_TIME_SHIFT 2
+#endif
+typedef uint16_t onebutton_time_t;
+typedef int16_t onebutton_timediff_t;
+#else
+#undef ONEBUTTON_TIME_SHIFT
+#define ONEBUTTON_TIME_SHIFT 0
+typedef unsigned long onebutton_time_t;
+typedef long onebutton_timediff_t;
+#endif
+
+
+template <uint8_t N, class Input>
+class OneButtonGroup;
+
+class OneButton;
+class OneButtonTraceBase;
+
+#if __ONEBTN_STATS__
+// Statistics collected by a OneButton instance.
+struct oneButtonStats_t {
+  unsigned long ticks;           // number of tick() calls
+  unsigned long minTickUs;       // shortest tick() duration in usecs
+  unsigned long maxTickUs;       // longest tick() duration in usecs
+  unsigned long sumTickUs;       // sum of all tick() durations for calculating the average
+  unsigned long stateTicks[8];   // number of FSM runs per state
+  unsigned long debounceRejects; // number of raw levels dropped by debouncing
+  unsigned long events;          // number of dispatched events
+  unsigned long maxLatencyMs;    // longest time from the raw edge to the event dispatch
+  unsigned long sumLatencyMs;    // sum of all latencies for calculating the average
+};
+#endif
+
+// Function type for receiving all events of a button by a single function.
+typedef void (*eventCallbackFunction)(OneButton *button, oneButtonEvent_t event, void *parameter);
 
 
 class OneButton {
@@ -93,6 +183,14 @@ public:
   };  // deprecated
   void setDebounceMs(const int ms);
 
+  /**
+   * Select the debounce algorithm.
+   * @param mode OBD_STABLE (default) accepts a level after it was stable for the debounce time,
+   * OBD_INTEGRATOR rejects short noise pulses without restarting the debounce time and
+   * OBD_LOCKOUT accepts a level change immediately and ignores further changes for the debounce time.
+   */
+  void setDebounceMode(const uint8_t mode);
+
   /**
    * set # millisec after single click is assumed.
    */
@@ -119,6 +217,21 @@ public:
     _long_press_interval_ms = ms;
   };
 
+  /**
+   * Use an auto repeat acceleration table for the DuringLongPress event instead of the fixed interval.
+   * The first repeat is reported delayMs after the long press start. The following intervals are taken from
+   * the table: `count` repeats of the first step, then `count` repeats of the next step and so on.
+   * The last step is used until the button is released.
+   * @param table The steps, the table must stay valid while it is used. NULL to use the fixed interval again.
+   * @param steps The number of steps in the table.
+   * @param delayMs msecs from the long press start to the first repeat.
+   */
+  void setRepeat(const oneButtonRepeatStep_t *table, const uint8_t steps, const uint16_t delayMs = 0) {
+    _repeatTable = steps ? table : NULL;
+    _repeatSteps = steps;
+    _repeatDelayMs = delayMs;
+  };
+
   /**
    * set # millisec after idle is assumed.
    */
@@ -128,6 +241,9 @@ public:
 
   /**
    * Attach an interupt to be called immediately when a pin change is detected.
+   * The library owned ISR of the button marks the button as changed so tick() can skip reading
+   * the pin while the button is resting. Up to ONEBUTTON_ISR_SLOTS buttons can be bound this way.
+   * This replaces the edge capture of attachEdgeInterupt() and releases its edge slot.
    * @param userFunc This function will be called when the event has been detected. If no function provided use default
    */
   void attachInterupt(uint8_t mode = CHANGE, void (*userFunc)(void) = isrDefaultUnused);
@@ -144,6 +260,63 @@ public:
    */
   void disableInterupt(uint8_t mode = CHANGE, void (*userFunc)(void) = isrDefaultUnused);
 
+  /**
+   * Detach the pin change interrupt and release the ISR slot and the edge slot of the button.
+   * tick() reads the pin again. Call it before a button with an interrupt is destroyed.
+   */
+  void detachInterupt();
+
+  /**
+   * @return true when a library owned ISR is bound by attachInterupt() or attachEdgeInterupt().
+   */
+  bool isInteruptAttached() const {
+    return _isrSlot != OneButtonIsr::NO_SLOT;
+  }
+
+  /**
+   * Attach a library owned interrupt that captures every level change of the pin with a timestamp.
+   * tick() then only processes the captured edges and evaluates timeouts while a button press flow is active,
+   * so a resting button costs neither a digitalRead() nor a millis() call.
+   * This replaces the user function of attachInterupt(), the ISR slot of the button is reused.
+   * @return false when all ONEBUTTON_EDGE_SLOTS are in use or no pin is configured.
+   */
+  bool attachEdgeInterupt();
+
+  /**
+   * Capture the current pin level with a timestamp.
+   * This is called by the library owned interrupt but can be called from any other ISR as well.
+   */
+  void captureEdge();
+
+  /**
+   * Use the edge capture mode with the edges given by an external capture interrupt, e.g. OneButtonCapture.
+   * No pin change interrupt is attached.
+   * @return false when all ONEBUTTON_EDGE_SLOTS are in use or no pin is configured.
+   */
+  bool attachEdgeCapture();
+
+  /**
+   * Store a level change with its exact time, e.g. taken by a hardware input capture unit.
+   * Can be called from any ISR after attachEdgeInterupt() or attachEdgeCapture().
+   * @param pinLevel The pin level (HIGH or LOW) after the edge.
+   * @param ms The time of the edge in msecs on the time base of millis(), finer times are not stored.
+   */
+  void captureEdge(const int pinLevel, const unsigned long ms);
+
+  /**
+   * Attach a single function that is called for all events of this button.
+   * It is called after the function attached for the specific event.
+   * Multi clicks are detected when using this function.
+   * There is only one such function per button. It is also used by OneButtonEventQueue, OneButtonGestures
+   * and OneButtonShared, so a button can be connected to one of them or to one application function only.
+   * Attach NULL to release it.
+   * @param newFunction This function will be called with the button, the event and the parameter.
+   * @param parameter This pointer is passed to the function.
+   * @return false when another function or parameter is attached already, it stays attached.
+   */
+  bool attachEvent(eventCallbackFunction newFunction, void *parameter = NULL);
+
+#if !ONEBUTTON_COMPACT_CALLBACKS
   /**
    * Attach an event to be called immediately when a depress is detected.
    * @param newFunction This function will be called when the event has been detected.
@@ -188,7 +361,7 @@ public:
 
   /**
    * Attach an event to fire periodically while the button is held down.
-   * The period of calls is set by setLongPressIntervalMs(ms).
+   * The period of calls is set by setLongPressIntervalMs(ms) or by an auto repeat table, see setRepeat().
    * @param newFunction
    */
   void attachDuringLongPress(callbackFunction newFunction);
@@ -199,22 +372,73 @@ public:
    * @param newFunction
    */
   void attachIdle(callbackFunction newFunction);
+  void attachIdle(parameterizedCallbackFunction newFunction, void *parameter);
+
+  /**
+   * Attach a member function of an object or any other delegate to an event, see OneButtonDelegate.
+   * Example: button.attachClick(ONEBUTTON_DELEGATE(this, &Menu::next));
+   * @param delegate This delegate will be called when the event has been detected.
+   */
+  void attachPress(const OneButtonDelegate &delegate) {
+    attachPress(delegate.function(), delegate.parameter());
+  }
+  void attachClick(const OneButtonDelegate &delegate) {
+    attachClick(delegate.function(), delegate.parameter());
+  }
+  void attachDoubleClick(const OneButtonDelegate &delegate) {
+    attachDoubleClick(delegate.function(), delegate.parameter());
+  }
+  void attachMultiClick(const OneButtonDelegate &delegate) {
+    attachMultiClick(delegate.function(), delegate.parameter());
+  }
+  void attachLongPressStart(const OneButtonDelegate &delegate) {
+    attachLongPressStart(delegate.function(), delegate.parameter());
+  }
+  void attachLongPressStop(const OneButtonDelegate &delegate) {
+    attachLongPressStop(delegate.function(), delegate.parameter());
+  }
+  void attachDuringLongPress(const OneButtonDelegate &delegate) {
+    attachDuringLongPress(delegate.function(), delegate.parameter());
+  }
+  void attachIdle(const OneButtonDelegate &delegate) {
+    attachIdle(delegate.function(), delegate.parameter());
+  }
+#endif
+
+  /**
+   * Enable the detection of events for polling the result of tick() without attaching functions.
+   * @param mask The events as a combination of OBM_* values, e.g. OBM_DOUBLECLICK | OBM_DURINGLONGPRESS.
+   * Detecting OBM_DOUBLECLICK or OBM_MULTICLICK delays single clicks by the click time.
+   */
+  void setPollEvents(const uint8_t mask);
 
   // ----- State machine functions -----
 
   /**
    * @brief Call this function every some milliseconds for checking the input
    * level at the initialized digital pin.
+   * @return The events detected in this tick as a combination of OBM_* values.
    */
-  void tick(void);
+  uint8_t tick(void);
 
   /**
    * @brief Call this function every time the input level has changed.
    * Using this function no digital input pin is checked because the current
    * level is given by the parameter.
    * Run the finite state machine (FSM) using the given level.
+   * @return The events detected in this tick as a combination of OBM_* values.
    */
-  void tick(bool activeLevel);
+  uint8_t tick(bool activeLevel);
+
+  /**
+   * @brief Run the finite state machine (FSM) using the given level and time.
+   * Sample millis() once per scan and pass it to all buttons so they share
+   * the same timestamp and save the repeated reading of the clock.
+   * @param activeLevel true when the button is pressed.
+   * @param ms current time in msecs as returned by millis().
+   * @return The events detected in this tick as a combination of OBM_* values.
+   */
+  uint8_t tick(bool activeLevel, unsigned long ms);
 
 
   /**
@@ -225,6 +449,7 @@ public:
 
   /*
    * return number of clicks in any case: single or multiple clicks
+   * The number of the last click sequence is kept until the next press.
    */
   int getNumberClicks(void);
 
@@ -237,6 +462,14 @@ public:
     return _state == OCS_INIT;
   }
 
+  /**
+   * @return true when the button is debouncing or inside a press flow and tick() should be called
+   * at a high rate. When false the button only waits for a level change and can be ticked less often.
+   */
+  bool wantsFastTick() const {
+    return !_isResting();
+  }
+
   /**
    * @return true when a long press is detected
    */
@@ -244,10 +477,62 @@ public:
     return _state == OCS_PRESS;
   };
 
+  /**
+   * Calculate when the state machine needs the next tick() to detect a timeout based event.
+   * Level changes are not predictable so they wake up the processor by an interrupt.
+   * @return msecs until the next timeout, 0 when tick() should be called immediately, e.g. for captured edges, or
+   * ONEBUTTON_NO_DEADLINE when only a level change can advance the state machine.
+   */
+  unsigned long nextDeadlineMs() const;
+
+#if __ONEBTN_STATS__
+  /**
+   * @return the statistics collected since start or the last resetStats().
+   */
+  const oneButtonStats_t &getStats() const {
+    return _stats;
+  }
+
+  /**
+   * Clear all statistics.
+   */
+  void resetStats();
+#endif
+
+#if ONEBUTTON_TRACE
+  /**
+   * Record the raw level changes that reach the debouncing into a trace.
+   * @param trace The trace or NULL to stop recording.
+   */
+  void attachTrace(OneButtonTraceBase *trace) {
+    _trace = trace;
+  }
+#endif
+
 
 private:
+  template <uint8_t N, class Input>
+  friend class OneButtonGroup;
+
   static void isrDefaultUnused();
-  static void (*isrCallback)();
+  static void _edgeHandler(void *context);
+
+  // Ring buffer of captured edges for one button using the library owned ISR.
+  struct edgeSlot_t {
+    OneButton *button;
+    volatile uint8_t head;    // written by the ISR only
+    volatile uint8_t tail;    // written by tick() only
+    volatile uint8_t levels;  // bit n holds the level of time[n]
+    volatile onebutton_time_t time[ONEBUTTON_EDGE_BUFFER];
+  };
+  static edgeSlot_t _edgeSlots[ONEBUTTON_EDGE_SLOTS];
+  static constexpr uint8_t NO_EDGE_SLOT = 0xFF;
+  static uint8_t _freeEdgeSlot();
+  void _useEdgeSlot(const uint8_t n);
+  void _releaseEdgeSlot();
+
+  uint8_t _edgeSlot = NO_EDGE_SLOT;            // index into _edgeSlots when using attachEdgeInterupt()
+  uint8_t _isrSlot = OneButtonIsr::NO_SLOT;  // slot of the library owned ISR
   uint8_t _mode = CHANGE;
   int _pin = -1;                 // hardware pin number.
   int _debounce_ms = 50;         // number of msecs for debounce times.
@@ -255,11 +540,15 @@ private:
   unsigned int _press_ms = 800;  // number of msecs before a long button press is detected
   unsigned int _idle_ms = 1000;  // number of msecs before idle is detected
 
-  int _buttonPressed = 0;  // this is the level of the input pin when the button is pressed.
-                           // LOW if the button connects the input pin to GND when pressed.
-                           // HIGH if the button connects the input pin to VCC when pressed.
+  uint8_t _buttonPressed = 0;  // this is the level of the input pin when the button is pressed.
+                               // LOW if the button connects the input pin to GND when pressed.
+                               // HIGH if the button connects the input pin to VCC when pressed.
 
   // These variables will hold functions acting as event source.
+  eventCallbackFunction _eventFunc = NULL;
+  void *_eventParam = NULL;
+
+#if !ONEBUTTON_COMPACT_CALLBACKS
   callbackFunction _pressFunc = NULL;
   parameterizedCallbackFunction _paramPressFunc = NULL;
   void *_pressFuncParam = NULL;
@@ -289,19 +578,22 @@ private:
   void *_duringLongPressFuncParam = NULL;
 
   callbackFunction _idleFunc = NULL;
+  parameterizedCallbackFunction _paramIdleFunc = NULL;
+  void *_idleFuncParam = NULL;
+#endif
 
   // These variables that hold information across the upcoming tick calls.
   // They are initialized once on program start and are updated every time the
   // tick function is called.
 
   // define FiniteStateMachine
-  enum stateMachine_t : int {
-    OCS_INIT = 0,
-    OCS_DOWN = 1,   // button is down
-    OCS_UP = 2,     // button is up
-    OCS_COUNT = 3,  // in multi press-mode, counting
-    OCS_PRESS = 6,  // button is hold down
-    OCS_PRESSEND = 7,
+  enum stateMachine_t : uint8_t {
+    OCS_INIT = OBS_INIT,
+    OCS_DOWN = OBS_DOWN,    // button is down
+    OCS_UP = OBS_UP,        // button is up
+    OCS_COUNT = OBS_COUNT,  // in multi press-mode, counting
+    OCS_PRESS = OBS_PRESS,  // button is hold down
+    OCS_PRESSEND = OBS_PRESSEND,
   };
 
   /**
@@ -314,21 +606,171 @@ private:
    */
   void _newState(stateMachine_t nextState);
 
+  /**
+   * Debounce the given level using the time in `now`.
+   */
+  bool _debounce(const bool value);
+  bool _integrate(const bool value);
+
+  /**
+   * Process captured edges and run the FSM only when a button press flow is active.
+   */
+  void _tickEdges();
+
+  /**
+   * Advance the FSM at the time the last captured level became stable.
+   */
+  void _advanceStable(const onebutton_time_t time);
+
+  /**
+   * Run the FSM at the times of its timeouts that are before the given time.
+   */
+  void _advanceTimeouts(const onebutton_time_t time);
+
+  /**
+   * Call the functions attached for the event.
+   */
+  void _fire(const oneButtonEvent_t event);
+
+  /**
+   * @return true when a function for the idle event is attached.
+   */
+  bool _hasIdleFunc() const {
+#if ONEBUTTON_COMPACT_CALLBACKS
+    return _eventFunc || (_pollEvents & OBM_IDLE);
+#else
+    return _idleFunc || _paramIdleFunc || _eventFunc || (_pollEvents & OBM_IDLE);
+#endif
+  }
+
+  /**
+   * @return true when a function for the DuringLongPress event is attached.
+   */
+  bool _hasDuringLongPressFunc() const {
+#if ONEBUTTON_COMPACT_CALLBACKS
+    return _eventFunc || (_pollEvents & OBM_DURINGLONGPRESS);
+#else
+    return _duringLongPressFunc || _paramDuringLongPressFunc || _eventFunc || (_pollEvents & OBM_DURINGLONGPRESS);
+#endif
+  }
+
+  /**
+   * @return time units after _lastDebounceTime when the current raw level will be accepted.
+   */
+  onebutton_time_t _debounceWait() const {
+    onebutton_time_t limit = _time(abs(_debounce_ms));
+    if (_debounceMode != OBD_INTEGRATOR) return limit;
+    return _lastDebounceLevel ? (onebutton_time_t)(limit - min(_integral, limit)) : _integral;
+  }
+
+  /**
+   * @return true when the FSM will not change without a new input level.
+   */
+  bool _isResting() const {
+    return (_state == OCS_INIT) && (debouncedLevel == _lastDebounceLevel) && (_idleState || !_hasIdleFunc());
+  }
+
+  // ----- storage of the state machine, see OneButtonFsm -----
+
+  typedef OneButtonFsm<onebutton_time_t, ONEBUTTON_TIME_SHIFT> fsm_t;
+  friend fsm_t;
+
+  uint8_t _fsmState() const { return _state; }
+  void _fsmSetState(const uint8_t s) { _state = (stateMachine_t)s; }
+  uint8_t _fsmClicks() const { return _nClicks; }
+  void _fsmSetClicks(const uint8_t c) { _nClicks = c; }
+  onebutton_time_t _fsmStartTime() const { return _startTime; }
+  void _fsmSetStartTime(const onebutton_time_t t) {
+    _startTime = t;
+#if ONEBUTTON_TIME_16
+    _pressWraps = 0;
+#endif
+  }
+  onebutton_time_t _fsmPressTime() const { return _time(_press_ms); }
+  onebutton_time_t _fsmClickTime() const { return _time(_click_ms); }
+  onebutton_time_t _fsmIdleTime() const { return _time(_idle_ms); }
+  uint8_t _fsmMaxClicks() const { return _maxClicks; }
+  bool _fsmHasLongPress() const { return true; }
+  bool _fsmWaitsIdle() const { return !_idleState && _hasIdleFunc(); }
+  void _fsmSetIdle(const bool fired) { _idleState = fired; }
+  bool _fsmHasDuringLongPress() const { return _hasDuringLongPressFunc(); }
+  onebutton_time_t _fsmDuringTime() const { return _lastDuringLongPressTime; }
+  void _fsmSetDuringTime(const onebutton_time_t t) { _lastDuringLongPressTime = t; }
+  onebutton_time_t _fsmDuringInterval() const { return _time(_repeatTable ? _repeatIntervalMs : _long_press_interval_ms); }
+  void _fsmPressing(const onebutton_time_t waitTime) {
+#if ONEBUTTON_TIME_16
+    if (waitTime & 0x8000) {
+      // keep the press time in range for getPressedMs().
+      _startTime += 0x8000;
+      _pressWraps++;
+    }
+#else
+    (void)waitTime;
+#endif
+  }
+  void _fsmFire(const oneButtonEvent_t event) {
+    if ((event == OBE_LONGPRESSSTART) || (event == OBE_DURINGLONGPRESS)) _repeat(event);
+    _fire(event);
+  }
+
   stateMachine_t _state = OCS_INIT;
 
   bool _idleState = false;
 
   bool debouncedLevel = false;
   bool _lastDebounceLevel = false;      // used for pin debouncing
-  unsigned long _lastDebounceTime = 0;  // millis()
-  unsigned long now = 0;                // millis()
+  onebutton_time_t _lastDebounceTime = 0;  // millis()
+  onebutton_time_t now = 0;                // millis()
+
+  onebutton_time_t _startTime = 0;  // start time of current activeLevel change
+#if ONEBUTTON_TIME_16
+  uint16_t _pressWraps = 0;  // number of half ranges added to _startTime during a long press
+#endif
+  uint8_t _nClicks = 0;          // count the number of clicks with this variable
+  uint8_t _maxClicks = 1;        // max number (1, 2, multi=3) of clicks of interest by registration of event functions.
+
+  uint8_t _pollEvents = 0;  // events enabled by setPollEvents()
+  uint8_t _debounceMode = OBD_STABLE;
+  onebutton_time_t _integral = 0;  // OBD_INTEGRATOR: active time minus inactive time, 0..debounce time
+  uint8_t _events = 0;      // events detected in the current tick
+
+  unsigned int _long_press_interval_ms = 0;       // interval in msecs between calls of the DuringLongPress event
+  onebutton_time_t _lastDuringLongPressTime = 0;  // used to produce the DuringLongPress interval
+
+  const oneButtonRepeatStep_t *_repeatTable = NULL;  // auto repeat acceleration table, see setRepeat()
+  uint8_t _repeatSteps = 0;
+  uint16_t _repeatDelayMs = 0;     // msecs from the long press start to the first repeat
+  uint16_t _repeatIntervalMs = 0;  // msecs to the next repeat
+  uint16_t _repeatCount = 0;       // number of DuringLongPress events in the current long press
+
+  /**
+   * Update the repeat counter and the interval to the next repeat for a long press event.
+   */
+  void _repeat(const oneButtonEvent_t event);
+
+  /**
+   * Convert msecs to the timebase and back.
+   */
+  static inline onebutton_time_t _time(const unsigned long ms) {
+    return (onebutton_time_t)(ms >> ONEBUTTON_TIME_SHIFT);
+  }
+  static inline unsigned long _ms(const onebutton_time_t time) {
+    return (unsigned long)time << ONEBUTTON_TIME_SHIFT;
+  }
 
-  unsigned long _startTime = 0;  // start time of current activeLevel change
-  int _nClicks = 0;              // count the number of clicks with this variable
-  int _maxClicks = 1;            // max number (1, 2, multi=3) of clicks of interest by registration of event functions.
+#if __ONEBTN_STATS__
+  oneButtonStats_t _stats = {};
+  onebutton_time_t _statsEdgeTime = 0;  // time of the raw edge of the current debounced level
 
-  unsigned int _long_press_interval_ms = 0;    // interval in msecs between calls of the DuringLongPress event
-  unsigned long _lastDuringLongPressTime = 0;  // used to produce the DuringLongPress interval
+  /**
+   * Add the duration of a tick() call to the statistics.
+   */
+  void _countTick(const unsigned long startUs);
+#endif
+
+#if ONEBUTTON_TRACE
+  OneButtonTraceBase *_trace = NULL;
+#endif
 
 public:
   int pin() const {
@@ -344,10 +786,44 @@ public:
 
   /**
    * @brief Use this function in the DuringLongPress and LongPressStop events to get the time since the button was pressed.
-   * @return milliseconds from the start of the button press.
+   * @return milliseconds from the start of the button press until the current tick.
    */
   unsigned long getPressedMs() {
-    return (millis() - _startTime);
+#if ONEBUTTON_TIME_16
+    return ((unsigned long)_pressWraps << (15 + ONEBUTTON_TIME_SHIFT)) + _ms((onebutton_time_t)(now - _startTime));
+#else
+    return (now - _startTime);
+#endif
+  };
+
+  /**
+   * @brief Use this function in the DuringLongPress event to get the number of the repeat.
+   * @return number of DuringLongPress events in the current long press, 1 for the first one.
+   */
+  uint16_t getRepeatCount() const {
+    return _repeatCount;
+  };
+
+  /**
+   * @brief Use this function in the DuringLongPress event to get the current repeat rate.
+   * @return msecs until the next DuringLongPress event.
+   */
+  unsigned int getRepeatIntervalMs() const {
+    return _repeatTable ? _repeatIntervalMs : _long_press_interval_ms;
+  };
+
+  /**
+   * @brief Use this function in the event functions to get a timestamp of the event.
+   * @return the time of the current tick in milliseconds.
+   */
+  unsigned long getTickMs() const {
+#if ONEBUTTON_TIME_16
+    // extend the timestamp to the full range of millis().
+    unsigned long ms = millis();
+    return (ms & ~((1UL << ONEBUTTON_TIME_SHIFT) - 1)) - _ms((onebutton_time_t)(_time(ms) - now));
+#else
+    return now;
+#endif
   };
 };
 
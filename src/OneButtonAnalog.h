@@ -0,0 +1,200 @@
+// -----
+// OneButtonAnalog.h - Library for detecting button clicks, doubleclicks and long
+// press pattern on the keys of a resistor ladder keypad connected to a single
+// analog input. This class is implemented for use with the Arduino environment.
+// Copyright (c) by Matthias Hertel, http://www.mathertel.de
+// This work is licensed under a BSD style license. See
+// http://www.mathertel.de/License.aspx More information on:
+// http://www.mathertel.de/Arduino
+// -----
+// 14.10.2026 created to scan resistor ladder keypads with one conversion per scan.
+// -----
+
+#ifndef OneButtonAnalog_h
+#define OneButtonAnalog_h
+
+#include "OneButton.h"
+
+/**
+ * Scan up to N keys of a resistor ladder keypad connected to one analog pin.
+ *
+ * Only one analog conversion is taken per sample. The value is classified into the key value ranges
+ * and the level of every virtual button is given to its state machine using the time sampled once per scan.
+ *
+ * On classic AVR processors the conversion is started and polled without waiting for the ADC
+ * so tick() never blocks. Calling analogRead() for other pins in between is possible but delays the next sample.
+ * On other processors analogRead() is called once per sample.
+ *
+ * Buttons must be created without a pin. The debouncing of the buttons is used.
+ */
+template <uint8_t N>
+class OneButtonAnalog {
+public:
+  // ----- Constructor -----
+
+  /**
+   * @param pin The analog pin the resistor ladder is connected to.
+   */
+  explicit OneButtonAnalog(const uint8_t pin)
+    : _pin(pin) {}
+
+  // ----- Set runtime parameters -----
+
+  /**
+   * Add a key of the keypad.
+   * @param button A button created without a pin.
+   * @param minValue The lowest analog value of the key.
+   * @param maxValue The highest analog value of the key.
+   * @return The index of the key or -1 when all keys are used.
+   */
+  int add(OneButton &button, const int minValue, const int maxValue) {
+    if (_count == N) return -1;
+
+    uint8_t n = _count++;
+    _buttons[n] = &button;
+    _min[n] = minValue;
+    _max[n] = maxValue;
+    return n;
+  }  // add()
+
+
+  /**
+   * set # millisec between 2 analog conversions.
+   */
+  void setSampleMs(const unsigned int ms) {
+    _sample_ms = ms;
+  }
+
+  // ----- State machine functions -----
+
+  /**
+   * @brief Call this function every some milliseconds for checking all keys.
+   */
+  void tick(void) {
+    tickAll(millis());
+  }  // tick()
+
+
+  /**
+   * @brief Check all keys using a time sampled once per scan.
+   * @param now current time in msecs as returned by millis().
+   */
+  void tickAll(const unsigned long now) {
+    if ((now - _lastSampleTime) >= _sample_ms) {
+      int value;
+      if (_read(value)) {
+        _lastSampleTime = now;
+        _value = value;
+        _key = _classify(value);
+      }
+    }
+
+    for (uint8_t n = 0; n < _count; n++) {
+      _buttons[n]->tick(n == _key, now);
+    }
+  }  // tickAll()
+
+
+  /**
+   * @return the last analog value.
+   */
+  int value() const {
+    return _value;
+  }
+
+  /**
+   * @return index of the key pressed in the last sample or -1 when no key is pressed.
+   */
+  int key() const {
+    return (_key < _count) ? _key : -1;
+  }
+
+  /**
+   * @return number of keys.
+   */
+  uint8_t count() const {
+    return _count;
+  }
+
+  /**
+   * @return the button with the given index.
+   */
+  OneButton *button(const uint8_t index) const {
+    return (index < _count) ? _buttons[index] : NULL;
+  }
+
+
+private:
+  static constexpr uint8_t NO_KEY = 0xFF;
+
+  uint8_t _pin;
+  OneButton *_buttons[N];
+  int _min[N];
+  int _max[N];
+  uint8_t _count = 0;
+
+  unsigned int _sample_ms = 5;
+  unsigned long _lastSampleTime = 0;
+  int _value = 0;
+  uint8_t _key = NO_KEY;
+
+  /**
+   * Find the key with a value range containing the given value.
+   */
+  uint8_t _classify(const int value) const {
+    for (uint8_t n = 0; n < _count; n++) {
+      if ((value >= _min[n]) && (value <= _max[n])) return n;
+    }
+    return NO_KEY;
+  }  // _classify()
+
+
+#if defined(ADCSRA) && defined(ADSC) && defined(ADMUX)
+  // classic AVR: start a conversion and pick up the result in a later sample.
+  bool _started = false;
+  uint8_t _admux;
+#if defined(ADCSRB) && defined(MUX5)
+  uint8_t _adcsrb;
+#endif
+
+  void _start() {
+    ADMUX = _admux;
+#if defined(ADCSRB) && defined(MUX5)
+    ADCSRB = (ADCSRB & ~_BV(MUX5)) | _adcsrb;
+#endif
+    ADCSRA |= _BV(ADSC);
+  }
+
+  bool _read(int &value) {
+    if (!_started) {
+      // the first conversion is done by analogRead() to setup the channel and reference.
+      value = analogRead(_pin);
+      _admux = ADMUX;
+#if defined(ADCSRB) && defined(MUX5)
+      _adcsrb = ADCSRB & _BV(MUX5);
+#endif
+      _started = true;
+      _start();
+      return true;
+    }
+
+    if (ADCSRA & _BV(ADSC)) return false;  // conversion still running.
+    if (ADMUX != _admux) {
+      // analogRead() was used for another pin: the result belongs to that pin.
+      _start();
+      return false;
+    }
+    value = ADC;
+    _start();
+    return true;
+  }  // _read()
+
+#else
+  bool _read(int &value) {
+    value = analogRead(_pin);
+    return true;
+  }  // _read()
+#endif
+};
+
+#endif
@@ -0,0 +1,194 @@
+/**
+ * @file OneButtonCapture.cpp
+ *
+ * @brief Hardware input capture of the edges of buttons.
+ *
+ * @author Matthias Hertel, https://www.mathertel.de
+ * @Copyright Copyright (c) by Matthias Hertel, https://www.mathertel.de.
+ *
+ * This work is licensed under a BSD style license. See
+ * http://www.mathertel.de/License.aspx
+ *
+ * More information on: https://www.mathertel.de/Arduino/OneButtonLibrary.aspx
+ *
+ * Changelog: see OneButtonCapture.h
+ */
+
+#include "OneButtonCapture.h"
+
+OneButton *volatile OneButtonCapture::_buttons[OneButtonCapture::CHANNELS];
+uint8_t OneButtonCapture::_count = 0;
+
+
+#if defined(__AVR__) && defined(TIMER1_CAPT_vect) && defined(ICR1) && defined(ICES1)
+
+bool OneButtonCapture::begin(OneButton &button, const bool pullup) {
+  (void)pullup;
+  if ((_count == CHANNELS) || !button.attachEdgeCapture()) return false;
+  _buttons[_count++] = &button;
+
+  noInterrupts();
+  TCCR1A = 0;                                   // normal mode
+  TCCR1B = _BV(ICNC1) | _BV(CS11) | _BV(CS10);  // noise canceler, prescaler 64
+  // wait for the edge leaving the current level.
+  if (digitalRead(button.pin()) == LOW) TCCR1B |= _BV(ICES1);
+  TIFR1 = _BV(ICF1);
+  TIMSK1 |= _BV(ICIE1);
+  interrupts();
+  return true;
+}
+
+void OneButtonCapture::end() {
+  TIMSK1 &= ~_BV(ICIE1);
+  _count = 0;
+}
+
+void OneButtonCapture::capture() {
+  OneButton *button = _buttons[0];
+  uint16_t elapsed = TCNT1 - ICR1;  // timer ticks since the edge
+  int level = (TCCR1B & _BV(ICES1)) ? HIGH : LOW;
+  unsigned long now = millis();
+  unsigned long us = (unsigned long)elapsed * 64UL / (F_CPU / 1000000UL);
+  // the edge slots store msecs, the capture removes the interrupt latency but not the msec resolution.
+  button->captureEdge(level, now - (us / 1000));
+
+  // wait for the edge leaving the current level. A missed edge is taken with the current time.
+  int pinLevel = digitalRead(button->pin());
+  if (pinLevel != level) button->captureEdge(pinLevel, now);
+  if (pinLevel == LOW) {
+    TCCR1B |= _BV(ICES1);
+  } else {
+    TCCR1B &= ~_BV(ICES1);
+  }
+  TIFR1 = _BV(ICF1);  // changing the edge may set the flag.
+}
+
+ISR(TIMER1_CAPT_vect) {
+  OneButtonCapture::capture();
+}
+
+
+#elif defined(ONEBUTTON_CAPTURE_MCPWM)
+
+mcpwm_cap_timer_handle_t OneButtonCapture::_timer = NULL;
+mcpwm_cap_channel_handle_t OneButtonCapture::_channels[OneButtonCapture::CHANNELS];
+
+uint32_t OneButtonCapture::_resolution = 0;
+uint32_t OneButtonCapture::_lastValue = 0;
+int64_t OneButtonCapture::_lastTicks = 0;
+int64_t OneButtonCapture::_startUs = 0;
+bool OneButtonCapture::_started = false;
+
+// runs in interrupt context, the edge is taken by the capture unit.
+bool OneButtonCapture::_onCapture(mcpwm_cap_channel_handle_t channel, const mcpwm_capture_event_data_t *edata, void *context) {
+  (void)channel;
+  int level = (edata->cap_edge == MCPWM_CAP_EDGE_POS) ? HIGH : LOW;
+  int64_t nowUs = esp_timer_get_time();
+
+  // without an edge for more than an hour the first edge is taken again.
+  if (!_started || (nowUs - _startUs > 3600000000LL)) {
+    _startUs = nowUs;
+    _lastTicks = 0;
+    _lastValue = edata->cap_value;
+    _started = true;
+  }
+
+  // ticks since _startUs, the channels share the timer so the edge may be before the last one.
+  int64_t ticks = _lastTicks + (int32_t)(edata->cap_value - _lastValue);
+
+  // the edge happened less than half a period of the 32 bit timer before now.
+  int64_t nowTicks = (nowUs - _startUs) * _resolution / 1000000LL;
+  while (nowTicks - ticks > (1LL << 31)) ticks += (1LL << 32);
+  while (nowTicks - ticks <= -(1LL << 31)) ticks -= (1LL << 32);
+
+  // move the start by whole seconds to keep the numbers small.
+  int64_t secs = ticks / _resolution;
+  _startUs += secs * 1000000LL;
+  ticks -= secs * (int64_t)_resolution;
+  _lastTicks = ticks;
+  _lastValue = edata->cap_value;
+
+  int64_t edgeUs = _startUs + ticks * 1000000LL / _resolution;
+  if (edgeUs > nowUs) edgeUs = nowUs;
+  // the edge slots store msecs like on AVR.
+  ((OneButton *)context)->captureEdge(level, (unsigned long)(edgeUs / 1000LL));
+  return false;
+}
+
+bool OneButtonCapture::begin(OneButton &button, const bool pullup) {
+  if ((_count == CHANNELS) || (button.pin() < 0)) return false;
+
+  if (!_timer) {
+    mcpwm_capture_timer_config_t timerConfig = {};
+    timerConfig.group_id = 0;
+    timerConfig.clk_src = MCPWM_CAPTURE_CLK_SRC_DEFAULT;
+    if (mcpwm_new_capture_timer(&timerConfig, &_timer) != ESP_OK) return false;
+    if ((mcpwm_capture_timer_get_resolution(_timer, &_resolution) != ESP_OK) || (_resolution == 0)) {
+      mcpwm_del_capture_timer(_timer);
+      _timer = NULL;
+      return false;
+    }
+    _started = false;
+    mcpwm_capture_timer_enable(_timer);
+    mcpwm_capture_timer_start(_timer);
+  }
+
+  mcpwm_capture_channel_config_t channelConfig = {};
+  channelConfig.gpio_num = button.pin();
+  channelConfig.prescale = 1;
+  channelConfig.flags.pos_edge = true;
+  channelConfig.flags.neg_edge = true;
+  mcpwm_cap_channel_handle_t channel = NULL;
+  if (mcpwm_new_capture_channel(_timer, &channelConfig, &channel) != ESP_OK) return false;
+  if (pullup) gpio_pullup_en((gpio_num_t)button.pin());
+
+  if (!button.attachEdgeCapture()) {
+    mcpwm_del_capture_channel(channel);
+    return false;
+  }
+
+  mcpwm_capture_event_callbacks_t callbacks = {};
+  callbacks.on_cap = _onCapture;
+  mcpwm_capture_channel_register_event_callbacks(channel, &callbacks, &button);
+  mcpwm_capture_channel_enable(channel);
+
+  _channels[_count] = channel;
+  _buttons[_count++] = &button;
+  return true;
+}
+
+void OneButtonCapture::end() {
+  for (uint8_t n = 0; n < _count; n++) {
+    mcpwm_capture_channel_disable(_channels[n]);
+    mcpwm_del_capture_channel(_channels[n]);
+  }
+  _count = 0;
+
+  if (_timer) {
+    mcpwm_capture_timer_stop(_timer);
+    mcpwm_capture_timer_disable(_timer);
+    mcpwm_del_capture_timer(_timer);
+    _timer = NULL;
+  }
+}
+
+void OneButtonCapture::capture() {}
+
+
+#else
+
+// no capture unit supported: call OneButton::captureEdge(level, ms) from your own capture interrupt.
+bool OneButtonCapture::begin(OneButton &button, const bool pullup) {
+  (void)button;
+  (void)pullup;
+  return false;
+}
+
+void OneButtonCapture::end() {}
+
+void OneButtonCapture::capture() {}
+
+#endif
+
+
+// end.
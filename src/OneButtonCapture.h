@@ -0,0 +1,89 @@
+// -----
+// OneButtonCapture.h - Timestamp the level changes of buttons by a hardware input
+// capture unit. This class is implemented for use with the Arduino environment.
+// Copyright (c) by Matthias Hertel, http://www.mathertel.de
+// This work is licensed under a BSD style license. See
+// http://www.mathertel.de/License.aspx More information on:
+// http://www.mathertel.de/Arduino
+// -----
+// 14.10.2026 created to take edge times independent of interrupt latencies.
+// 14.10.2026 ESP32 edge times taken from the capture values.
+// 14.10.2026 static members and capture interrupt moved to OneButtonCapture.cpp.
+// -----
+//
+// The capture interrupt routine is in OneButtonCapture.cpp and is only linked into sketches
+// using this class, so Timer1 stays available in all other sketches.
+//
+// The captured edges are given to the edge capture mode of the buttons so tick() replays them
+// with their exact times. The press durations and all timeouts do not depend on the time
+// tick() is called or on the latency of the interrupt.
+// The capture units measure in usecs but the edges are stored in msecs like the other timestamps of OneButton,
+// so the resolution of the edge times is 1 msec (4 msecs with ONEBUTTON_TIME_16).
+//
+// Capture units used:
+// * AVR: Timer1 input capture (ICP1, pin 8 on the Uno and Nano) for one button.
+//   Timer1 runs in normal mode with prescaler 64, so analogWrite() on the Timer1 pins and the Servo library
+//   cannot be used. The timer edge is converted into the time base of millis().
+// * ESP32: MCPWM capture channels with the driver of ESP-IDF 5 (Arduino-ESP32 3.x) for up to 3 buttons.
+//   The driver cannot read the capture timer, so the time of an edge is the time of the previous edge plus
+//   the captured timer ticks between them. Only the first edge is taken with the latency of the interrupt.
+// On other platforms begin() returns false and the edges can be given by OneButton::captureEdge(level, ms)
+// from your own capture interrupt after OneButton::attachEdgeCapture().
+
+#ifndef OneButtonCapture_h
+#define OneButtonCapture_h
+
+#include "OneButton.h"
+
+#if defined(ESP32) && defined(__has_include)
+#if __has_include(<driver/mcpwm_cap.h>)
+#include <driver/mcpwm_cap.h>
+#include <driver/gpio.h>
+#include <esp_timer.h>
+#define ONEBUTTON_CAPTURE_MCPWM 1
+#endif
+#endif
+
+
+class OneButtonCapture {
+public:
+  /**
+   * Start capturing the edges of the button pin.
+   * On AVR the button must be connected to the ICP1 pin.
+   * @param button The button, it is switched to the edge capture mode.
+   * @param pullup true to keep the internal pull-up enabled after the capture unit took over the pin.
+   * @return false when no more capture channels are available or not supported on this platform.
+   */
+  static bool begin(OneButton &button, const bool pullup = true);
+
+  /**
+   * Stop capturing the edges of all buttons.
+   */
+  static void end();
+
+  /**
+   * Store the captured edge. Called by the AVR capture interrupt.
+   */
+  static void capture();
+
+private:
+#if defined(ONEBUTTON_CAPTURE_MCPWM)
+  static constexpr uint8_t CHANNELS = 3;
+  static mcpwm_cap_timer_handle_t _timer;
+  static mcpwm_cap_channel_handle_t _channels[CHANNELS];
+  static uint32_t _resolution;  // capture timer ticks per second
+  static uint32_t _lastValue;   // capture value of the last edge of any channel
+  static int64_t _lastTicks;    // timer ticks from _startUs to the last edge
+  static int64_t _startUs;      // reference time in usecs on the time base of esp_timer_get_time()
+  static bool _started;         // the reference is taken
+
+  static bool _onCapture(mcpwm_cap_channel_handle_t channel, const mcpwm_capture_event_data_t *edata, void *context);
+#else
+  static constexpr uint8_t CHANNELS = 1;
+#endif
+
+  static OneButton *volatile _buttons[CHANNELS];
+  static uint8_t _count;
+};
+
+#endif
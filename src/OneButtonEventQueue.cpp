@@ -0,0 +1,78 @@
+/**
+ * @file OneButtonEventQueue.cpp
+ *
+ * @brief Lock free queue for the events detected by OneButton instances.
+ *
+ * @author Matthias Hertel, https://www.mathertel.de
+ * @Copyright Copyright (c) by Matthias Hertel, https://www.mathertel.de.
+ *
+ * This work is licensed under a BSD style license. See
+ * http://www.mathertel.de/License.aspx
+ *
+ * More information on: https://www.mathertel.de/Arduino/OneButtonLibrary.aspx
+ *
+ * Changelog: see OneButtonEventQueue.h
+ */
+
+#include "OneButtonEventQueue.h"
+
+// route all events of the button to this queue.
+bool OneButtonEventQueueBase::attach(OneButton &button) {
+  return button.attachEvent(_enqueue, this);
+}  // attach()
+
+
+// create the event record for a button event, called inside tick().
+void OneButtonEventQueueBase::_enqueue(OneButton *button, oneButtonEvent_t event, void *parameter) {
+  oneButtonEventRecord_t record;
+  record.button = button;
+  record.event = event;
+  record.clicks = button->getNumberClicks();
+  record.time = button->getTickMs();
+  record.pressedMs = 0;
+  record.repeats = 0;
+  record.intervalMs = 0;
+
+  if ((event == OBE_LONGPRESSSTART) || (event == OBE_LONGPRESSSTOP) || (event == OBE_DURINGLONGPRESS)) {
+    unsigned long ms = button->getPressedMs();
+    record.pressedMs = (ms > 0xFFFF) ? 0xFFFF : ms;
+  }
+  if (event == OBE_DURINGLONGPRESS) {
+    record.repeats = button->getRepeatCount();
+    record.intervalMs = button->getRepeatIntervalMs();
+  }
+  ((OneButtonEventQueueBase *)parameter)->push(record);
+}  // _enqueue()
+
+
+bool OneButtonEventQueueBase::push(const oneButtonEventRecord_t &record) {
+  uint8_t head = _head;
+
+  if ((uint8_t)(head - _tail) == _size) {
+    _dropped++;
+    return false;
+  }
+
+  _records[head & (_size - 1)] = record;
+  // the record must be complete before the consumer can see it.
+  ONEBUTTON_MEMORY_BARRIER();
+  _head = head + 1;
+  return true;
+}  // push()
+
+
+bool OneButtonEventQueueBase::pop(oneButtonEventRecord_t &record) {
+  uint8_t tail = _tail;
+
+  if (tail == _head) return false;
+
+  ONEBUTTON_MEMORY_BARRIER();
+  record = _records[tail & (_size - 1)];
+  // the record must be copied before the producer can overwrite it.
+  ONEBUTTON_MEMORY_BARRIER();
+  _tail = tail + 1;
+  return true;
+}  // pop()
+
+
+// end.
@@ -0,0 +1,106 @@
+// -----
+// OneButtonEventQueue.h - Queue for the events detected by OneButton instances.
+// This class is implemented for use with the Arduino environment.
+// Copyright (c) by Matthias Hertel, http://www.mathertel.de
+// This work is licensed under a BSD style license. See
+// http://www.mathertel.de/License.aspx More information on:
+// http://www.mathertel.de/Arduino
+// -----
+// 14.10.2026 created to decouple event detection from event handling.
+// 14.10.2026 repeat count and interval of the DuringLongPress event in the record.
+// 14.10.2026 attach() fails when attachEvent() of the button is used already.
+// -----
+
+#ifndef OneButtonEventQueue_h
+#define OneButtonEventQueue_h
+
+#include "OneButton.h"
+
+// ----- Event record -----
+
+struct oneButtonEventRecord_t {
+  OneButton *button;       // the button that detected the event
+  oneButtonEvent_t event;  // the event type
+  uint8_t clicks;          // number of clicks
+  uint16_t pressedMs;      // msecs since the press started for long press events
+  uint16_t repeats;        // number of the repeat for DuringLongPress events
+  uint16_t intervalMs;     // msecs to the next repeat for DuringLongPress events
+  unsigned long time;      // time of the tick that detected the event
+};
+
+
+/**
+ * Lock free single producer, single consumer ring buffer of event records.
+ *
+ * The OneButton instances are the producer by calling tick() and the application is the consumer.
+ * No callbacks are called from tick() any more so tick() can be called from a timer ISR.
+ * Use the OneButtonEventQueue<N> template to create a queue with storage.
+ */
+class OneButtonEventQueueBase {
+public:
+  /**
+   * Send all events of the button to this queue.
+   * This uses the attachEvent() function of the button.
+   * @param button The button.
+   * @return false when another function is attached by attachEvent() of the button already.
+   */
+  bool attach(OneButton &button);
+
+  /**
+   * Add an event record. Called by the producer only.
+   * @return false when the queue is full and the record was dropped.
+   */
+  bool push(const oneButtonEventRecord_t &record);
+
+  /**
+   * Take the oldest event record. Called by the consumer only.
+   * @return false when the queue is empty.
+   */
+  bool pop(oneButtonEventRecord_t &record);
+
+  /**
+   * @return true when no event record is available.
+   */
+  bool isEmpty() const {
+    return _head == _tail;
+  }
+
+  /**
+   * @return number of event records dropped because the queue was full.
+   */
+  uint16_t getDropped() const {
+    return _dropped;
+  }
+
+protected:
+  OneButtonEventQueueBase(oneButtonEventRecord_t *records, const uint8_t size)
+    : _records(records), _size(size) {}
+
+private:
+  static void _enqueue(OneButton *button, oneButtonEvent_t event, void *parameter);
+
+  oneButtonEventRecord_t *_records;
+  uint8_t _size;
+  volatile uint8_t _head = 0;  // written by the producer only
+  volatile uint8_t _tail = 0;  // written by the consumer only
+  volatile uint16_t _dropped = 0;
+};
+
+
+/**
+ * Event queue with storage for N event records.
+ * @tparam N size of the queue, a power of 2 up to 128.
+ */
+template <uint8_t N>
+class OneButtonEventQueue : public OneButtonEventQueueBase {
+  static_assert((N > 0) && (N <= 128) && ((N & (N - 1)) == 0), "N must be a power of 2 up to 128");
+
+public:
+  OneButtonEventQueue()
+    : OneButtonEventQueueBase(_buffer, N) {}
+
+private:
+  oneButtonEventRecord_t _buffer[N];
+};
+
+#endif
@@ -0,0 +1,200 @@
+// -----
+// OneButtonFsm.h - The state machine for detecting button clicks, doubleclicks and
+// long press pattern shared by all button classes of the OneButton library.
+// This class is implemented for use with the Arduino environment.
+// Copyright (c) by Matthias Hertel, http://www.mathertel.de
+// This work is licensed under a BSD style license. See
+// http://www.mathertel.de/License.aspx More information on:
+// http://www.mathertel.de/Arduino
+// -----
+// 14.10.2026 created from the state machines of OneButton and OneButtonTiny.
+// -----
+
+#ifndef OneButtonFsm_h
+#define OneButtonFsm_h
+
+#include "OneButtonTypes.h"
+
+// The states of the state machine, the same numbers are used by all button classes.
+#define OBS_INIT 0
+#define OBS_DOWN 1      // button is down
+#define OBS_UP 2        // button is up
+#define OBS_COUNT 3     // in multi press-mode, counting
+#define OBS_PRESS 4     // button is hold down
+#define OBS_PRESSEND 5  // button was released after a long press
+
+
+/**
+ * State machine core used by OneButton, OneButtonTiny, OneButtonTinyArray and OneButtonStatic.
+ *
+ * The core runs on the debounced level and holds no data. The button class is the storage policy and
+ * provides the data and the enabled events by inline functions so the compiler can remove the code of
+ * unused events and use the packed storage of the class:
+ *
+ * * `uint8_t _fsmState()`, `void _fsmSetState(uint8_t)`: the state, one of the OBS_XXX values.
+ * * `uint8_t _fsmClicks()`, `void _fsmSetClicks(uint8_t)`: the number of clicks.
+ * * `Time _fsmStartTime()`, `void _fsmSetStartTime(Time)`: the start time of the current level.
+ * * `Time _fsmPressTime()`, `Time _fsmClickTime()`, `Time _fsmIdleTime()`: the timeouts in the timebase.
+ * * `uint8_t _fsmMaxClicks()`: the max number of clicks of interest.
+ * * `bool _fsmHasLongPress()`: false when long presses are counted as clicks.
+ * * `bool _fsmWaitsIdle()`, `void _fsmSetIdle(bool)`: the idle event is enabled and not yet reported.
+ * * `bool _fsmHasDuringLongPress()`, `Time _fsmDuringTime()`, `void _fsmSetDuringTime(Time)`,
+ *   `Time _fsmDuringInterval()`: the DuringLongPress event and its interval.
+ * * `void _fsmPressing(Time waitTime)`: called on every tick of a long press.
+ * * `void _fsmFire(oneButtonEvent_t)`: report an event.
+ *
+ * @tparam Time The type of the timestamps, uint16_t or unsigned long.
+ * @tparam Shift A time unit of the timestamps is 2^Shift msecs.
+ */
+template <typename Time, uint8_t Shift>
+class OneButtonFsm {
+public:
+  /**
+   * Run the state machine using the debounced level.
+   * @param s The button.
+   * @param activeLevel true when the button is pressed.
+   * @param now The current time in the timebase of the button.
+   */
+  template <class S>
+  static inline void run(S &s, const bool activeLevel, const Time now) {
+    Time waitTime = now - s._fsmStartTime();
+
+    switch (s._fsmState()) {
+      case OBS_INIT:
+        // on idle for idle_ms call idle function
+        if (s._fsmWaitsIdle() && (waitTime > s._fsmIdleTime())) {
+          s._fsmSetIdle(true);
+          s._fsmFire(OBE_IDLE);
+        }
+
+        // waiting for level to become active.
+        if (activeLevel) {
+          s._fsmSetState(OBS_DOWN);
+          s._fsmSetStartTime(now);  // remember starting time
+          s._fsmSetClicks(0);
+          s._fsmFire(OBE_PRESS);
+        }
+        break;
+
+      case OBS_DOWN:
+        // waiting for level to become inactive.
+        if (!activeLevel) {
+          s._fsmSetState(OBS_UP);
+          s._fsmSetStartTime(now);  // remember starting time
+
+        } else if (s._fsmHasLongPress() && (waitTime > s._fsmPressTime())) {
+          s._fsmFire(OBE_LONGPRESSSTART);
+          s._fsmSetState(OBS_PRESS);
+        }
+        break;
+
+      case OBS_UP:
+        // count as a short button down
+        s._fsmSetClicks(s._fsmClicks() + 1);
+        s._fsmSetState(OBS_COUNT);
+        break;
+
+      case OBS_COUNT:
+        // dobounce time is over, count clicks
+        if (activeLevel) {
+          // button is down again
+          s._fsmSetState(OBS_DOWN);
+          s._fsmSetStartTime(now);  // remember starting time
+
+        } else if ((waitTime >= s._fsmClickTime()) || (s._fsmClicks() >= s._fsmMaxClicks())) {
+          // now we know how many clicks have been made.
+          uint8_t clicks = s._fsmClicks();
+          if (clicks == 1) {
+            s._fsmFire(OBE_CLICK);
+          } else if (clicks == 2) {
+            s._fsmFire(OBE_DOUBLECLICK);
+          } else {
+            s._fsmFire(OBE_MULTICLICK);
+          }
+          // the number of clicks is kept until the next press.
+          _reset(s, now);
+        }
+        break;
+
+      case OBS_PRESS:
+        // waiting for pin being release after long press.
+        if (!activeLevel) {
+          s._fsmSetState(OBS_PRESSEND);
+
+        } else {
+          // still the button is pressed
+          s._fsmPressing(waitTime);
+          if (s._fsmHasDuringLongPress() && ((Time)(now - s._fsmDuringTime()) >= s._fsmDuringInterval())) {
+            s._fsmFire(OBE_DURINGLONGPRESS);
+            s._fsmSetDuringTime(now);
+          }
+        }
+        break;
+
+      case OBS_PRESSEND:
+        // button was released.
+        s._fsmFire(OBE_LONGPRESSSTOP);
+        s._fsmSetClicks(0);
+        _reset(s, now);
+        break;
+
+      default:
+        // unknown state detected -> reset state machine
+        s._fsmSetState(OBS_INIT);
+        break;
+    }  // switch
+  }  // run()
+
+
+  /**
+   * Calculate when the state machine needs the next tick to detect a timeout based event.
+   * @return msecs until the next timeout, 0 when the state machine should run immediately or
+   * ONEBUTTON_NO_DEADLINE when only a level change can advance the state machine.
+   */
+  template <class S>
+  static inline unsigned long nextDeadlineMs(const S &s, const Time now) {
+    switch (s._fsmState()) {
+      case OBS_INIT:
+        return s._fsmWaitsIdle() ? remainingMs(s._fsmStartTime(), s._fsmIdleTime() + 1, now) : ONEBUTTON_NO_DEADLINE;
+
+      case OBS_DOWN:
+        return s._fsmHasLongPress() ? remainingMs(s._fsmStartTime(), s._fsmPressTime() + 1, now) : ONEBUTTON_NO_DEADLINE;
+
+      case OBS_COUNT:
+        return (s._fsmClicks() >= s._fsmMaxClicks()) ? 0 : remainingMs(s._fsmStartTime(), s._fsmClickTime(), now);
+
+      case OBS_PRESS:
+        return s._fsmHasDuringLongPress() ? remainingMs(s._fsmDuringTime(), s._fsmDuringInterval(), now) : ONEBUTTON_NO_DEADLINE;
+
+      default:
+        // transient states are left on the next tick.
+        return 0;
+    }  // switch
+  }  // nextDeadlineMs()
+
+
+  /**
+   * Calculate the msecs left until a time span has passed, also used for the debouncing of the button classes.
+   * @param start The start time of the time span in the timebase of the button.
+   * @param duration The length of the time span in time units.
+   * @param now The current time in the timebase of the button.
+   * @return msecs left, 0 when the time span has passed.
+   */
+  static inline unsigned long remainingMs(const Time start, const Time duration, const Time now) {
+    Time elapsed = now - start;
+    return (elapsed >= duration) ? 0 : ((unsigned long)(Time)(duration - elapsed) << Shift);
+  }
+
+
+private:
+  // back to the initial state, the idle time starts now.
+  template <class S>
+  static inline void _reset(S &s, const Time now) {
+    s._fsmSetState(OBS_INIT);
+    s._fsmSetStartTime(now);
+    s._fsmSetIdle(false);
+  }
+
+};
+
+#endif
@@ -0,0 +1,257 @@
+// -----
+// OneButtonGestures.h - Library for detecting gestures like chords and sequences
+// made of several buttons. This class is implemented for use with the Arduino
+// environment. Copyright (c) by Matthias Hertel, http://www.mathertel.de
+// This work is licensed under a BSD style license. See
+// http://www.mathertel.de/License.aspx More information on:
+// http://www.mathertel.de/Arduino
+// -----
+// 14.10.2026 created to detect chords and sequences of buttons.
+// 14.10.2026 add() fails when attachEvent() of the button is used already.
+// -----
+
+#ifndef OneButtonGestures_h
+#define OneButtonGestures_h
+
+#include "OneButton.h"
+
+// ----- Gesture table -----
+
+enum oneButtonGestureType_t : uint8_t {
+  OBG_CHORD = 0,    // both buttons pressed together
+  OBG_SEQUENCE = 1  // first button clicked, then second button clicked
+};
+
+struct oneButtonGesture_t {
+  oneButtonGestureType_t type;
+  uint8_t first;   // index of the first button
+  uint8_t second;  // index of the second button
+  uint16_t ms;     // chord: max. msecs between both presses, sequence: max. msecs from the first click to the second press
+};
+
+typedef void (*gestureCallbackFunction)(uint8_t gesture, void *parameter);
+
+
+/**
+ * Detect gestures of up to N buttons using a table of chords and sequences.
+ *
+ * The engine receives all events of the added buttons by their attachEvent() function.
+ * The events that are not part of a gesture are passed to the function registered by attachEvent()
+ * of the engine. The events of the buttons involved in a detected gesture are suppressed until the
+ * press flow of these buttons ends.
+ *
+ * A click of a button that starts a sequence is held back until the sequence time has passed.
+ * tick() of the engine must be called after the buttons or the group have been ticked.
+ */
+template <uint8_t N>
+class OneButtonGestures {
+public:
+  // ----- Constructor -----
+
+  /**
+   * @param gestures The table of gestures.
+   * @param count The number of gestures in the table.
+   */
+  OneButtonGestures(const oneButtonGesture_t *gestures, const uint8_t count)
+    : _gestures(gestures), _gestureCount(count) {}
+
+  // ----- Set runtime parameters -----
+
+  /**
+   * Add a button. The index in the gesture table is the order of adding.
+   * @return The index of the button or -1 when all buttons are used or another function is attached
+   * by attachEvent() of the button already.
+   */
+  int add(OneButton &button) {
+    if (_count == N) return -1;
+    if (!button.attachEvent(_onEvent, this)) return -1;
+
+    uint8_t n = _count++;
+    _buttons[n] = &button;
+    _flags[n] = 0;
+    _sequence[n] = NO_GESTURE;
+    _pressTime[n] = _clickTime[n] = 0;
+    return n;
+  }  // add()
+
+
+  /**
+   * Attach a function that will be called when a gesture was detected.
+   * @param newFunction This function will be called with the index of the gesture in the table.
+   * @param parameter This pointer will be passed to the function.
+   */
+  void attachGesture(gestureCallbackFunction newFunction, void *parameter = NULL) {
+    _gestureFunc = newFunction;
+    _gestureParam = parameter;
+  }
+
+  /**
+   * Attach a function that will be called for all button events that are not part of a gesture.
+   * @param newFunction This function will be called with the button and the event type.
+   * @param parameter This pointer will be passed to the function.
+   */
+  void attachEvent(eventCallbackFunction newFunction, void *parameter = NULL) {
+    _eventFunc = newFunction;
+    _eventParam = parameter;
+  }
+
+  // ----- State machine functions -----
+
+  /**
+   * @brief Pass the held back clicks when no sequence was started in time.
+   */
+  void tick(void) {
+    tick(millis());
+  }  // tick()
+
+
+  /**
+   * @brief Pass the held back clicks using a time sampled once per scan.
+   * @param now current time in msecs as returned by millis().
+   */
+  void tick(const unsigned long now) {
+    for (uint8_t n = 0; n < _count; n++) {
+      if ((_flags[n] & FLAG_PENDING) && !_isSequenceStarted(n) && ((now - _clickTime[n]) > _sequenceMs(n))) {
+        _release(n);
+      }
+    }
+  }  // tick()
+
+
+private:
+  static constexpr uint8_t NO_GESTURE = 0xFF;
+  static constexpr uint8_t FLAG_SUPPRESS = 0x01;  // events are suppressed until the press flow ends
+  static constexpr uint8_t FLAG_PENDING = 0x02;   // a click is held back for a sequence
+
+  const oneButtonGesture_t *_gestures;
+  uint8_t _gestureCount;
+
+  OneButton *_buttons[N];
+  uint8_t _count = 0;
+
+  uint8_t _flags[N];
+  uint8_t _sequence[N];         // sequence gesture started by a press of this button
+  unsigned long _pressTime[N];  // time of the last press
+  unsigned long _clickTime[N];  // time of the held back click
+
+  gestureCallbackFunction _gestureFunc = NULL;
+  void *_gestureParam = NULL;
+  eventCallbackFunction _eventFunc = NULL;
+  void *_eventParam = NULL;
+
+
+  // receive the events from all buttons.
+  static void _onEvent(OneButton *button, oneButtonEvent_t event, void *parameter) {
+    OneButtonGestures *engine = (OneButtonGestures *)parameter;
+    for (uint8_t n = 0; n < engine->_count; n++) {
+      if (engine->_buttons[n] == button) {
+        engine->_handle(n, event, button->getTickMs());
+        break;
+      }
+    }
+  }  // _onEvent()
+
+
+  // match the event of button n against the gesture table.
+  void _handle(const uint8_t n, const oneButtonEvent_t event, const unsigned long now) {
+    bool flowEnd = (event == OBE_CLICK) || (event == OBE_DOUBLECLICK) || (event == OBE_MULTICLICK) || (event == OBE_LONGPRESSSTOP);
+
+    if (_flags[n] & FLAG_SUPPRESS) {
+      if (flowEnd) _flags[n] &= ~FLAG_SUPPRESS;
+      return;
+    }
+
+    if (event == OBE_PRESS) {
+      _pressTime[n] = now;
+
+      for (uint8_t g = 0; g < _gestureCount; g++) {
+        const oneButtonGesture_t &gesture = _gestures[g];
+        uint8_t other = (gesture.first == n) ? gesture.second : gesture.first;
+
+        if ((gesture.type == OBG_CHORD) && ((gesture.first == n) || (gesture.second == n)) && (other < _count)
+            && !(_flags[other] & FLAG_SUPPRESS) && _buttons[other]->debouncedValue() && ((now - _pressTime[other]) <= gesture.ms)) {
+          // both buttons are pressed together.
+          _flags[n] |= FLAG_SUPPRESS;
+          _flags[other] |= FLAG_SUPPRESS;
+          _sequence[n] = _sequence[other] = NO_GESTURE;
+          _fireGesture(g);
+          return;
+
+        } else if ((gesture.type == OBG_SEQUENCE) && (gesture.second == n) && (gesture.first < _count)
+                   && (_flags[gesture.first] & FLAG_PENDING) && ((now - _clickTime[gesture.first]) <= gesture.ms)) {
+          // the second button of a sequence was pressed in time.
+          _sequence[n] = g;
+        }
+      }
+
+    } else if (_sequence[n] != NO_GESTURE) {
+      uint8_t g = _sequence[n];
+      uint8_t first = _gestures[g].first;
+      _sequence[n] = NO_GESTURE;
+
+      if ((event == OBE_CLICK) && (_flags[first] & FLAG_PENDING)) {
+        // the sequence is complete: drop the held back click.
+        _flags[first] &= ~FLAG_PENDING;
+        _fireGesture(g);
+        return;
+      }
+      // no single click: the sequence failed.
+      if (_flags[first] & FLAG_PENDING) _release(first);
+
+    } else if ((event == OBE_CLICK) && _isSequenceStart(n)) {
+      // hold back the click until the sequence time has passed.
+      if (_flags[n] & FLAG_PENDING) _release(n);
+      _flags[n] |= FLAG_PENDING;
+      _clickTime[n] = now;
+      return;
+    }
+
+    _fireEvent(n, event);
+  }  // _handle()
+
+
+  // true when button n is the first button of a sequence gesture.
+  bool _isSequenceStart(const uint8_t n) const {
+    for (uint8_t g = 0; g < _gestureCount; g++) {
+      if ((_gestures[g].type == OBG_SEQUENCE) && (_gestures[g].first == n)) return true;
+    }
+    return false;
+  }  // _isSequenceStart()
+
+
+  // true when a press of another button continues a sequence started by button n.
+  bool _isSequenceStarted(const uint8_t n) const {
+    for (uint8_t m = 0; m < _count; m++) {
+      if ((_sequence[m] != NO_GESTURE) && (_gestures[_sequence[m]].first == n)) return true;
+    }
+    return false;
+  }  // _isSequenceStarted()
+
+
+  // max. msecs a click of button n is held back.
+  unsigned long _sequenceMs(const uint8_t n) const {
+    unsigned long ms = 0;
+    for (uint8_t g = 0; g < _gestureCount; g++) {
+      if ((_gestures[g].type == OBG_SEQUENCE) && (_gestures[g].first == n) && (_gestures[g].ms > ms)) ms = _gestures[g].ms;
+    }
+    return ms;
+  }  // _sequenceMs()
+
+
+  // pass the held back click of button n.
+  void _release(const uint8_t n) {
+    _flags[n] &= ~FLAG_PENDING;
+    _fireEvent(n, OBE_CLICK);
+  }  // _release()
+
+
+  void _fireEvent(const uint8_t n, const oneButtonEvent_t event) {
+    if (_eventFunc) _eventFunc(_buttons[n], event, _eventParam);
+  }
+
+  void _fireGesture(const uint8_t g) {
+    if (_gestureFunc) _gestureFunc(g, _gestureParam);
+  }
+};
+
+#endif
@@ -0,0 +1,346 @@
+// -----
+// OneButtonGroup.h - Library for detecting button clicks, doubleclicks and long
+// press pattern on many buttons in parallel. This class is implemented for use
+// with the Arduino environment. Copyright (c) by Matthias Hertel,
+// http://www.mathertel.de This work is licensed under a BSD style license. See
+// http://www.mathertel.de/License.aspx More information on:
+// http://www.mathertel.de/Arduino
+// -----
+// 14.10.2026 created to scan many buttons with port wide reads.
+// 14.10.2026 tickAll(now) with a time sampled once per scan.
+// 14.10.2026 pluggable input backends for shift registers and port expanders.
+// 14.10.2026 slower sampling while all buttons are idle.
+// 14.10.2026 setDebounceMode() with integrator and lockout vertical counters.
+// -----
+
+#ifndef OneButtonGroup_h
+#define OneButtonGroup_h
+
+#include "OneButton.h"
+
+/**
+ * Debounce 32 levels in parallel by a 2 bit vertical counter per level, called once per sample.
+ * * OBD_STABLE: a new level is accepted after 4 equal samples, a sample with the debounced level restarts the count.
+ * * OBD_INTEGRATOR: a sample with the debounced level counts down instead of restarting, so short noise pulses
+ *   are rejected without delaying a change that is valid most of the time.
+ * * OBD_LOCKOUT: a new level is accepted with the first sample, changes in the next 3 samples are ignored.
+ * @return the bits of the debounced levels that changed.
+ */
+inline uint32_t oneButtonVerticalDebounce(const uint8_t mode, const uint32_t raw, uint32_t &debounced, uint32_t &cnt0, uint32_t &cnt1) {
+  uint32_t delta = raw ^ debounced;
+  uint32_t toggle;
+
+  if (mode == OBD_INTEGRATOR) {
+    // count up with a different level, down with the debounced level, toggle when passing 3.
+    uint32_t down = ~delta & (cnt0 | cnt1);
+    toggle = delta & cnt0 & cnt1;
+    cnt1 ^= (delta & cnt0) | (down & ~cnt0);
+    cnt0 ^= delta | down;
+
+  } else if (mode == OBD_LOCKOUT) {
+    // accept the unlocked bits, count down the locked bits and lock the accepted bits for 3 samples.
+    uint32_t locked = cnt0 | cnt1;
+    toggle = delta & ~locked;
+    cnt1 ^= locked & ~cnt0;
+    cnt0 ^= locked;
+    cnt0 |= toggle;
+    cnt1 |= toggle;
+
+  } else {
+    // a bit toggles after 4 samples with a different level.
+    cnt1 = (cnt1 ^ cnt0) & delta;
+    cnt0 = ~cnt0 & delta;
+    toggle = delta & ~(cnt0 | cnt1);
+  }
+
+  debounced ^= toggle;
+  return toggle;
+}  // oneButtonVerticalDebounce()
+
+
+/**
+ * Input backend of a OneButtonGroup reading the digital pins of the buttons.
+ *
+ * The input registers of all used ports are read once per sample.
+ *
+ * An input backend provides the functions:
+ * * `bool add(uint8_t n, int pin)` to prepare the input of the button with index n.
+ * * `void read(uint32_t *levels, uint8_t count)` to read the input levels of the buttons 0..count-1
+ *   into the bit n % 32 of the word n / 32. A set bit stands for a HIGH level.
+ */
+template <uint8_t N>
+class OneButtonPinInput {
+public:
+  /**
+   * The button must be configured with a pin.
+   */
+  bool add(const uint8_t n, const int pin) {
+    if (pin < 0) return false;
+
+#ifdef portInputRegister
+    portRegister_t reg = portInputRegister(digitalPinToPort(pin));
+    uint8_t p = 0;
+    while ((p < _portCount) && (_ports[p] != reg)) p++;
+    if (p == _portCount) _ports[_portCount++] = reg;
+    _port[n] = p;
+    _mask[n] = digitalPinToBitMask(pin);
+#else
+    _pin[n] = pin;
+#endif
+    return true;
+  }  // add()
+
+
+  /**
+   * Read every used port once and collect the levels of the buttons.
+   */
+  void read(uint32_t *levels, const uint8_t count) {
+#ifdef portInputRegister
+    portMask_t portValue[N];
+    for (uint8_t p = 0; p < _portCount; p++) portValue[p] = *_ports[p];
+#endif
+
+    for (uint8_t n = 0; n < count; n++) {
+      if (n % 32 == 0) levels[n / 32] = 0;
+#ifdef portInputRegister
+      if (portValue[_port[n]] & _mask[n]) levels[n / 32] |= (1UL << (n % 32));
+#else
+      if (digitalRead(_pin[n])) levels[n / 32] |= (1UL << (n % 32));
+#endif
+    }
+  }  // read()
+
+
+private:
+#ifdef portInputRegister
+  typedef decltype(portInputRegister(0)) portRegister_t;
+  typedef decltype(digitalPinToBitMask(0)) portMask_t;
+
+  portRegister_t _ports[N];  // distinct input registers
+  uint8_t _port[N];          // index into _ports per button
+  portMask_t _mask[N];       // bit mask inside the input register per button
+  uint8_t _portCount = 0;
+#else
+  uint8_t _pin[N];
+#endif
+};
+
+
+/**
+ * Scan up to N OneButton instances together.
+ *
+ * The input levels of all buttons are read at once by the input backend, debounced in parallel by a
+ * 2 bit vertical counter (a level is accepted after 4 equal samples, see setDebounceMode()) and the state machine
+ * of a button is only advanced when its debounced level changed or a press flow is active.
+ *
+ * The default backend reads the pins of the buttons. Other backends like OneButtonShiftRegisterInput
+ * or OneButtonMCP23017Input read buttons created without a pin from external chips.
+ *
+ * The debouncing of the buttons itself is not used.
+ */
+template <uint8_t N, class Input = OneButtonPinInput<N>>
+class OneButtonGroup {
+public:
+  // ----- Constructor -----
+
+  OneButtonGroup() {}
+
+  /**
+   * @return the input backend for setting it up.
+   */
+  Input &input() {
+    return _input;
+  }
+
+  // ----- Set runtime parameters -----
+
+  /**
+   * Add a button to the group.
+   * The pin and active level are taken from the button configuration.
+   * @param button A button initialized with a pin or a button without pin for external inputs.
+   * @return The index of the button in the group or -1 when the group is full.
+   */
+  int add(OneButton &button) {
+    if ((_count == N) || !_input.add(_count, button._pin)) return -1;
+
+    uint8_t n = _count++;
+    _buttons[n] = &button;
+
+    // an active low button reads HIGH when not pressed.
+    if (button._buttonPressed == LOW) _invert[n / 32] |= (1UL << (n % 32));
+    return n;
+  }  // add()
+
+
+  /**
+   * set # millisec a level has to be stable. 4 samples are taken in this time.
+   */
+  void setDebounceMs(const unsigned int ms) {
+    _sample_ms = (ms < 4) ? 1 : (ms / 4);
+  }
+
+  /**
+   * Select the debounce algorithm of the vertical counters: OBD_STABLE (default), OBD_INTEGRATOR or OBD_LOCKOUT.
+   */
+  void setDebounceMode(const uint8_t mode) {
+    _debounceMode = mode;
+  }
+
+  /**
+   * set # millisec between 2 samples while all buttons are idle and all levels are stable.
+   * The first sample showing a level change switches back to the debounce sample rate.
+   * A press is seen up to this time later, the timing of the press flow is not affected. 0 disables the idle rate.
+   */
+  void setIdleSampleMs(const unsigned int ms) {
+    _idle_sample_ms = ms;
+  }
+
+  // ----- State machine functions -----
+
+  /**
+   * @brief Call this function every some milliseconds for checking all buttons of the group.
+   */
+  void tick(void) {
+    tickAll(millis());
+  }  // tick()
+
+
+  /**
+   * @brief Check all buttons of the group using a time sampled once per scan.
+   * All events of this scan get the same timestamp.
+   * @param now current time in msecs as returned by millis().
+   */
+  void tickAll(const unsigned long now) {
+    unsigned int sampleMs = _sample_ms;
+    if (_idle_sample_ms > _sample_ms && !wantsFastTick()) sampleMs = _idle_sample_ms;
+
+    if ((now - _lastSampleTime) >= sampleMs) {
+      _lastSampleTime = now;
+      _sample();
+    }
+
+    for (uint8_t w = 0; w < WORDS; w++) {
+      uint32_t pending = _changed[w] | _active[w];
+      _changed[w] = 0;
+
+      for (uint8_t b = 0; pending; b++, pending >>= 1) {
+        if (pending & 1) {
+          uint8_t n = w * 32 + b;
+          _step(n, now, (_debounced[w] >> b) & 1);
+        }
+      }
+    }
+  }  // tickAll()
+
+
+  /**
+   * @return true when any button of the group is debouncing or inside a press flow.
+   * When false the group is sampled at the idle sample rate.
+   */
+  bool wantsFastTick() const {
+    for (uint8_t w = 0; w < WORDS; w++) {
+      if (_changed[w] | _active[w] | _cnt0[w] | _cnt1[w]) return true;
+    }
+    return false;
+  }
+
+
+  /**
+   * Calculate when the group needs the next tick() for debouncing or a timeout of any button.
+   * @return msecs until the next timeout, 0 when tick() should be called immediately or
+   * ONEBUTTON_NO_DEADLINE when only a level change can advance any state machine.
+   */
+  unsigned long nextDeadlineMs() const {
+    unsigned long deadline = ONEBUTTON_NO_DEADLINE;
+
+    for (uint8_t w = 0; w < WORDS; w++) {
+      if (_changed[w]) return 0;
+
+      if (_cnt0[w] | _cnt1[w]) {
+        // some levels are not yet stable: more samples are required.
+        unsigned long elapsed = millis() - _lastSampleTime;
+        deadline = min(deadline, (elapsed >= _sample_ms) ? 0UL : (unsigned long)(_sample_ms - elapsed));
+      }
+
+      uint32_t active = _active[w];
+      for (uint8_t b = 0; active; b++, active >>= 1) {
+        if (active & 1) deadline = min(deadline, _buttons[w * 32 + b]->nextDeadlineMs());
+      }
+    }
+    return deadline;
+  }  // nextDeadlineMs()
+
+
+  /**
+   * @return number of buttons in the group.
+   */
+  uint8_t count() const {
+    return _count;
+  }
+
+  /**
+   * @return the button with the given index.
+   */
+  OneButton *button(const uint8_t index) const {
+    return (index < _count) ? _buttons[index] : NULL;
+  }
+
+
+private:
+  static constexpr uint8_t WORDS = (N + 31) / 32;
+
+  Input _input;
+  OneButton *_buttons[N];
+  uint8_t _count = 0;
+
+  unsigned int _sample_ms = 12;  // 4 samples for the default 50 msecs debounce time.
+  unsigned int _idle_sample_ms = 0;
+  unsigned long _lastSampleTime = 0;
+  uint8_t _debounceMode = OBD_STABLE;
+
+  uint32_t _invert[WORDS] = {};     // bit set for active low buttons
+  uint32_t _cnt0[WORDS] = {};       // vertical counter, low bit
+  uint32_t _cnt1[WORDS] = {};       // vertical counter, high bit
+  uint32_t _debounced[WORDS] = {};  // debounced active levels
+  uint32_t _changed[WORDS] = {};    // debounced level changed since last dispatch
+  uint32_t _active[WORDS] = {};     // FSM is not resting
+
+  /**
+   * Read all levels once and debounce them in parallel.
+   */
+  void _sample() {
+    uint32_t levels[WORDS];
+    _input.read(levels, _count);
+
+    for (uint8_t w = 0; w < WORDS; w++) {
+      uint8_t last = (_count > w * 32) ? min((uint8_t)(_count - w * 32), (uint8_t)32) : 0;
+      if (last == 0) break;
+
+      uint32_t raw = levels[w];
+      if (last < 32) raw &= (1UL << last) - 1;
+      raw ^= _invert[w];
+
+      _changed[w] |= oneButtonVerticalDebounce(_debounceMode, raw, _debounced[w], _cnt0[w], _cnt1[w]);
+    }
+  }  // _sample()
+
+
+  /**
+   * Advance the FSM of one button with the debounced level.
+   */
+  void _step(const uint8_t n, const unsigned long now, const bool level) {
+    OneButton *btn = _buttons[n];
+    btn->now = OneButton::_time(now);
+    btn->debouncedLevel = btn->_lastDebounceLevel = level;
+    btn->_fsm(level);
+
+    uint32_t bit = (1UL << (n % 32));
+    if (btn->_isResting()) {
+      _active[n / 32] &= ~bit;
+    } else {
+      _active[n / 32] |= bit;
+    }
+  }  // _step()
+};
+
+#endif
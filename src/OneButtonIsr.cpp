@@ -0,0 +1,88 @@
+/**
+ * @file OneButtonIsr.cpp
+ *
+ * @brief Table of pin change interrupt functions bound to button instances.
+ *
+ * @author Matthias Hertel, https://www.mathertel.de
+ * @Copyright Copyright (c) by Matthias Hertel, https://www.mathertel.de.
+ *
+ * This work is licensed under a BSD style license. See
+ * http://www.mathertel.de/License.aspx
+ *
+ * More information on: https://www.mathertel.de/Arduino/OneButtonLibrary.aspx
+ *
+ * Changelog: see OneButtonIsr.h
+ */
+
+#include "OneButtonIsr.h"
+
+static_assert((ONEBUTTON_ISR_SLOTS >= 1) && (ONEBUTTON_ISR_SLOTS <= 8), "ONEBUTTON_ISR_SLOTS must be 1..8");
+
+OneButtonIsr::slot_t OneButtonIsr::_slots[ONEBUTTON_ISR_SLOTS];
+volatile uint8_t OneButtonIsr::_count = 0;
+
+
+uint8_t OneButtonIsr::attach(handlerFunction handler, void *context, callbackFunction userFunc) {
+  // reuse the slot already bound to the context or take a free one.
+  uint8_t n = 0;
+  while ((n < ONEBUTTON_ISR_SLOTS) && (_slots[n].context != context)) n++;
+  if (n == ONEBUTTON_ISR_SLOTS) {
+    n = 0;
+    while ((n < ONEBUTTON_ISR_SLOTS) && _slots[n].context) n++;
+    if (n == ONEBUTTON_ISR_SLOTS) return NO_SLOT;
+  }
+
+  slot_t &slot = _slots[n];
+  noInterrupts();
+  slot.handler = handler;
+  slot.userFunc = userFunc;
+  slot.pending = false;
+  slot.context = context;
+  interrupts();
+  return n;
+}  // attach()
+
+
+void OneButtonIsr::detach(const uint8_t slot) {
+  if (slot >= ONEBUTTON_ISR_SLOTS) return;
+
+  slot_t &s = _slots[slot];
+  noInterrupts();
+  s.handler = NULL;
+  s.userFunc = NULL;
+  s.pending = false;
+  s.context = NULL;
+  interrupts();
+}  // detach()
+
+
+callbackFunction OneButtonIsr::isr(const uint8_t slot) {
+  switch (slot) {
+    case 0: return _isr<0>;
+#if ONEBUTTON_ISR_SLOTS > 1
+    case 1: return _isr<1>;
+#endif
+#if ONEBUTTON_ISR_SLOTS > 2
+    case 2: return _isr<2>;
+#endif
+#if ONEBUTTON_ISR_SLOTS > 3
+    case 3: return _isr<3>;
+#endif
+#if ONEBUTTON_ISR_SLOTS > 4
+    case 4: return _isr<4>;
+#endif
+#if ONEBUTTON_ISR_SLOTS > 5
+    case 5: return _isr<5>;
+#endif
+#if ONEBUTTON_ISR_SLOTS > 6
+    case 6: return _isr<6>;
+#endif
+#if ONEBUTTON_ISR_SLOTS > 7
+    case 7: return _isr<7>;
+#endif
+  }
+  return NULL;
+}  // isr()
+
+
+// end.
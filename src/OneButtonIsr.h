@@ -0,0 +1,102 @@
+// -----
+// OneButtonIsr.h - Table of pin change interrupt functions bound to button
+// instances for the OneButton and OneButtonTiny classes.
+// Copyright (c) by Matthias Hertel, http://www.mathertel.de
+// This work is licensed under a BSD style license. See
+// http://www.mathertel.de/License.aspx More information on:
+// http://www.mathertel.de/Arduino
+// -----
+// 14.10.2026 created to bind interrupts to button instances.
+// 14.10.2026 interrupt counter for sleeping without missing a pin change.
+// 14.10.2026 detach() to release a slot.
+// -----
+
+#ifndef OneButtonIsr_h
+#define OneButtonIsr_h
+
+#include "OneButtonTypes.h"
+
+// ONEBUTTON_ISR_SLOTS is the number of buttons that can use a library owned ISR (1..8).
+// A slot is used by attachInterupt() and attachEdgeInterupt().
+#ifndef ONEBUTTON_ISR_SLOTS
+#define ONEBUTTON_ISR_SLOTS 8
+#endif
+
+
+/**
+ * Every slot of the table has its own ISR function that marks the slot as pending
+ * and calls the handler with the bound context and an optional user function.
+ * No search for the button is needed in the ISR.
+ */
+class OneButtonIsr {
+public:
+  static constexpr uint8_t NO_SLOT = 0xFF;
+
+  typedef void (*handlerFunction)(void *context);
+
+  /**
+   * Use a free slot or update the slot already bound to the context.
+   * @param handler This function is called with the context in the ISR, may be NULL.
+   * @param context The button instance.
+   * @param userFunc This function is called after the handler in the ISR, may be NULL.
+   * @return the slot number or NO_SLOT when all ONEBUTTON_ISR_SLOTS are used.
+   */
+  static uint8_t attach(handlerFunction handler, void *context, callbackFunction userFunc);
+
+  /**
+   * Release a slot. The pin change interrupt using the ISR of the slot must be detached before.
+   * @param slot The slot returned by attach(), NO_SLOT is ignored.
+   */
+  static void detach(const uint8_t slot);
+
+  /**
+   * @return the handler bound to the slot.
+   */
+  static handlerFunction handler(const uint8_t slot) {
+    return _slots[slot].handler;
+  }
+
+  /**
+   * @return the ISR function of the slot for attaching it to the pin change interrupt.
+   */
+  static callbackFunction isr(const uint8_t slot);
+
+  /**
+   * Check and clear the pending flag set by the ISR of the slot.
+   * @return true when an interrupt happened since the last call.
+   */
+  static bool takePending(const uint8_t slot) {
+    if (!_slots[slot].pending) return false;
+    _slots[slot].pending = false;
+    return true;
+  }
+
+  /**
+   * @return the number of interrupts of all slots, wrapping at 256.
+   * A change shows that a pin change happened since the value was taken.
+   */
+  static uint8_t interruptCount() {
+    return _count;
+  }
+
+private:
+  struct slot_t {
+    handlerFunction handler;
+    void *context;
+    callbackFunction userFunc;
+    volatile bool pending;
+  };
+  static slot_t _slots[ONEBUTTON_ISR_SLOTS];
+  static volatile uint8_t _count;
+
+  template <uint8_t N>
+  static void _isr() {
+    slot_t &slot = _slots[N];
+    slot.pending = true;
+    _count++;
+    if (slot.handler) slot.handler(slot.context);
+    if (slot.userFunc) slot.userFunc();
+  }
+};
+
+#endif
@@ -0,0 +1,100 @@
+// -----
+// OneButtonMCP23017Input.h - Input backend for a OneButtonGroup reading the
+// buttons from MCP23017 I2C port expanders.
+// This class is implemented for use with the Arduino environment.
+// Copyright (c) by Matthias Hertel, http://www.mathertel.de
+// This work is licensed under a BSD style license. See
+// http://www.mathertel.de/License.aspx More information on:
+// http://www.mathertel.de/Arduino
+// -----
+// 14.10.2026 created to read 16 buttons per I2C transfer.
+// -----
+
+#ifndef OneButtonMCP23017Input_h
+#define OneButtonMCP23017Input_h
+
+#include <Wire.h>
+#include "OneButtonGroup.h"
+
+/**
+ * Read up to N buttons from MCP23017 port expanders using consecutive I2C addresses.
+ *
+ * All 16 inputs of an expander are read in one I2C transfer starting at the GPIOA register.
+ * The button n of the group is the input n % 16 (GPA0=0 ... GPB7=15) of the expander n / 16.
+ * The internal pullups are enabled so buttons can connect the inputs to GND.
+ */
+template <uint8_t N>
+class OneButtonMCP23017Input {
+public:
+  /**
+   * Configure all pins of the expanders as inputs with pullup.
+   * Wire.begin() must be called before.
+   * @param address The I2C address of the first expander.
+   * @param wire The I2C bus connected to the expanders.
+   */
+  void begin(const uint8_t address = 0x20, TwoWire &wire = Wire) {
+    _address = address;
+    _wire = &wire;
+
+    for (uint8_t c = 0; c < CHIPS; c++) {
+      _write(c, IODIRA, 0xFF);
+      _write(c, GPPUA, 0xFF);
+    }
+  }  // begin()
+
+
+  /**
+   * The buttons are created without a pin, the index in the group is the input number.
+   */
+  bool add(const uint8_t n, const int pin) {
+    (void)n;
+    (void)pin;
+    return true;
+  }  // add()
+
+
+  /**
+   * Read both ports of every used expander.
+   */
+  void read(uint32_t *levels, const uint8_t count) {
+    uint8_t chips = (count + 15) / 16;
+
+    for (uint8_t c = 0; c < chips; c++) {
+      _wire->beginTransmission(_address + c);
+      _wire->write(GPIOA);
+      _wire->endTransmission(false);
+      _wire->requestFrom((uint8_t)(_address + c), (uint8_t)2);
+      uint32_t value = _wire->read();
+      value |= (uint32_t)_wire->read() << 8;
+
+      if (c % 2 == 0) {
+        levels[c / 2] = value;
+      } else {
+        levels[c / 2] |= value << 16;
+      }
+    }
+  }  // read()
+
+
+private:
+  static constexpr uint8_t CHIPS = (N + 15) / 16;
+
+  // register addresses in the default IOCON.BANK = 0 mode.
+  static constexpr uint8_t IODIRA = 0x00;
+  static constexpr uint8_t GPPUA = 0x0C;
+  static constexpr uint8_t GPIOA = 0x12;
+
+  uint8_t _address = 0x20;
+  TwoWire *_wire = NULL;
+
+  // write the same value to the A and B register, the address is incremented automatically.
+  void _write(const uint8_t chip, const uint8_t reg, const uint8_t value) {
+    _wire->beginTransmission(_address + chip);
+    _wire->write(reg);
+    _wire->write(value);
+    _wire->write(value);
+    _wire->endTransmission();
+  }  // _write()
+};
+
+#endif
@@ -0,0 +1,292 @@
+// -----
+// OneButtonMatrix.h - Library for detecting button clicks, doubleclicks and long
+// press pattern on the keys of a matrix keypad. This class is implemented for use
+// with the Arduino environment. Copyright (c) by Matthias Hertel,
+// http://www.mathertel.de This work is licensed under a BSD style license. See
+// http://www.mathertel.de/License.aspx More information on:
+// http://www.mathertel.de/Arduino
+// -----
+// 14.10.2026 created to scan matrix keypads with the OneButtonTiny state machine.
+// 14.10.2026 setDebounceMode() with integrator and lockout vertical counters.
+// -----
+
+#ifndef OneButtonMatrix_h
+#define OneButtonMatrix_h
+
+#include "OneButtonTinyArray.h"
+#include "OneButtonGroup.h"
+
+/**
+ * Scan a keypad with ROWS x COLS keys. The key (row, col) has the index row * COLS + col.
+ *
+ * The rows are driven LOW one after the other while the other rows are left floating. The columns
+ * use the internal pull-up and are read with port wide reads by a OneButtonPinInput.
+ * The levels of all keys are debounced in parallel by a 2 bit vertical counter per row (a level is
+ * accepted after 4 equal samples) and the state machine of a key is only advanced when its debounced
+ * level changed or a press flow is active.
+ *
+ * The state machines of the keys are kept in a OneButtonTinyArray using 6 bytes per key,
+ * the event functions get the index of the key as parameter.
+ *
+ * Without diodes at the keys 3 pressed keys on the corners of a rectangle make the 4th corner look pressed.
+ * When a scan shows 2 rows with 2 or more common pressed columns the new presses in these rows are
+ * blocked until the pattern is resolved. Keys already pressed and all releases are not affected.
+ */
+template <uint8_t ROWS, uint8_t COLS>
+class OneButtonMatrix {
+  static_assert((ROWS > 0) && (COLS > 0) && (COLS <= 32), "1..32 columns are supported.");
+  static_assert(ROWS * COLS <= 255, "max. 255 keys are supported.");
+
+public:
+  static constexpr uint8_t KEYS = ROWS * COLS;
+
+  // ----- Constructor -----
+
+  /**
+   * @param rowPins The pins of the rows, they are driven LOW while scanning.
+   * @param colPins The pins of the columns, they are read with the internal pull-up.
+   */
+  OneButtonMatrix(const uint8_t *rowPins, const uint8_t *colPins) {
+    for (uint8_t r = 0; r < ROWS; r++) _rowPin[r] = rowPins[r];
+    for (uint8_t c = 0; c < COLS; c++) _colPin[c] = colPins[c];
+  }
+
+  /**
+   * Initialize the pins and the keys.
+   */
+  void begin() {
+    for (uint8_t r = 0; r < ROWS; r++) pinMode(_rowPin[r], INPUT);
+    for (uint8_t c = 0; c < COLS; c++) {
+      pinMode(_colPin[c], INPUT_PULLUP);
+      _input.add(c, _colPin[c]);
+    }
+    while (_keys.count() < KEYS) _keys.add();
+    // the levels are debounced by the matrix already.
+    _keys.setDebounceMs(0);
+  }  // begin()
+
+  // ----- Set runtime parameters -----
+
+  /**
+   * set # millisec a level has to be stable. 4 samples are taken in this time.
+   */
+  void setDebounceMs(const unsigned int ms) {
+    _sample_ms = (ms < 4) ? 1 : (ms / 4);
+  }
+
+  /**
+   * Select the debounce algorithm of the vertical counters: OBD_STABLE (default), OBD_INTEGRATOR or OBD_LOCKOUT.
+   */
+  void setDebounceMode(const uint8_t mode) {
+    _debounceMode = mode;
+  }
+
+  /**
+   * set # millisec after single click is assumed.
+   */
+  void setClickMs(const uint16_t ms) {
+    _keys.setClickMs(ms);
+  }
+
+  /**
+   * set # millisec after press is assumed.
+   */
+  void setPressMs(const uint16_t ms) {
+    _keys.setPressMs(ms);
+  }
+
+  /**
+   * set # microsec to wait after driving a row before the columns are read.
+   */
+  void setSettleUs(const uint8_t us) {
+    _settle_us = us;
+  }
+
+  /**
+   * Enable or disable blocking the ambiguous presses. Disable it for keypads with diodes.
+   */
+  void setGhostBlocking(const bool enabled) {
+    _ghostBlocking = enabled;
+  }
+
+  // ----- Attach events functions -----
+
+  /**
+   * Attach an event to be called when a single click is detected.
+   * @param newFunction This function will be called with the index of the key.
+   */
+  void attachClick(indexCallbackFunction newFunction) {
+    _keys.attachClick(newFunction);
+  }
+
+  /**
+   * Attach an event to be called after a double click is detected.
+   * @param newFunction This function will be called with the index of the key.
+   */
+  void attachDoubleClick(indexCallbackFunction newFunction) {
+    _keys.attachDoubleClick(newFunction);
+  }
+
+  /**
+   * Attach an event to fire when the key is pressed and held down.
+   * @param newFunction This function will be called with the index of the key.
+   */
+  void attachLongPressStart(indexCallbackFunction newFunction) {
+    _keys.attachLongPressStart(newFunction);
+  }
+
+  /**
+   * @return the state machines of the keys for attaching the other events.
+   */
+  OneButtonTinyArray<KEYS> &keys() {
+    return _keys;
+  }
+
+  // ----- State machine functions -----
+
+  /**
+   * @brief Call this function every some milliseconds for checking all keys.
+   */
+  void tick(void) {
+    tickAll(millis());
+  }  // tick()
+
+
+  /**
+   * @brief Check all keys using a time sampled once per scan.
+   * @param now current time in msecs as returned by millis().
+   */
+  void tickAll(const unsigned long now) {
+    if ((now - _lastSampleTime) >= _sample_ms) {
+      _lastSampleTime = now;
+      _sample();
+    }
+
+    for (uint8_t r = 0; r < ROWS; r++) {
+      uint32_t pending = _changed[r] | _active[r];
+      _changed[r] = 0;
+
+      for (uint8_t c = 0; pending; c++, pending >>= 1) {
+        if (pending & 1) {
+          uint8_t n = r * COLS + c;
+          uint32_t bit = (1UL << c);
+          _keys.tick(n, _debounced[r] & bit, now);
+          if (_keys.wantsFastTick(n)) {
+            _active[r] |= bit;
+          } else {
+            _active[r] &= ~bit;
+          }
+        }
+      }
+    }
+  }  // tickAll()
+
+
+  /**
+   * Calculate when the keypad needs the next tick() for debouncing or a timeout of any key.
+   * @return msecs until the next timeout, 0 when tick() should be called immediately or
+   * ONEBUTTON_NO_DEADLINE when only a level change can advance any state machine.
+   */
+  unsigned long nextDeadlineMs() const {
+    unsigned long deadline = ONEBUTTON_NO_DEADLINE;
+
+    for (uint8_t r = 0; r < ROWS; r++) {
+      if (_changed[r]) return 0;
+
+      if (_cnt0[r] | _cnt1[r]) {
+        // some levels are not yet stable: more samples are required.
+        unsigned long elapsed = millis() - _lastSampleTime;
+        deadline = min(deadline, (elapsed >= _sample_ms) ? 0UL : (unsigned long)(_sample_ms - elapsed));
+      }
+      if (_active[r]) deadline = min(deadline, _keys.nextDeadlineMs());
+    }
+    return deadline;
+  }  // nextDeadlineMs()
+
+
+  /**
+   * @return true when the key is pressed after debouncing.
+   */
+  bool isPressed(const uint8_t row, const uint8_t col) const {
+    return (row < ROWS) && (col < COLS) && (_debounced[row] & (1UL << col));
+  }
+
+  /**
+   * @return true when presses were blocked in the last scan because of possible ghost keys.
+   */
+  bool isGhosting() const {
+    return _ghosting;
+  }
+
+  /**
+   * @return number of keys.
+   */
+  uint8_t count() const {
+    return KEYS;
+  }
+
+
+private:
+  uint8_t _rowPin[ROWS];
+  uint8_t _colPin[COLS];
+  OneButtonPinInput<COLS> _input;
+  OneButtonTinyArray<KEYS> _keys;
+
+  unsigned int _sample_ms = 12;  // 4 samples for the default 50 msecs debounce time.
+  unsigned long _lastSampleTime = 0;
+  uint8_t _settle_us = 5;
+  uint8_t _debounceMode = OBD_STABLE;
+  bool _ghostBlocking = true;
+  bool _ghosting = false;
+
+  uint32_t _cnt0[ROWS] = {};       // vertical counter, low bit
+  uint32_t _cnt1[ROWS] = {};       // vertical counter, high bit
+  uint32_t _debounced[ROWS] = {};  // debounced pressed keys
+  uint32_t _changed[ROWS] = {};    // debounced level changed since last dispatch
+  uint32_t _active[ROWS] = {};     // FSM is not resting
+
+  /**
+   * Read all rows once and debounce all keys in parallel.
+   */
+  void _sample() {
+    uint32_t raw[ROWS];
+
+    for (uint8_t r = 0; r < ROWS; r++) {
+      pinMode(_rowPin[r], OUTPUT);
+      digitalWrite(_rowPin[r], LOW);
+      if (_settle_us) delayMicroseconds(_settle_us);
+      _input.read(&raw[r], COLS);
+      pinMode(_rowPin[r], INPUT);
+
+      // a pressed key pulls its column LOW.
+      raw[r] = ~raw[r];
+      if (COLS < 32) raw[r] &= (1UL << COLS) - 1;
+    }
+
+    _ghosting = false;
+    if (_ghostBlocking) _blockGhosts(raw);
+
+    for (uint8_t r = 0; r < ROWS; r++) {
+      _changed[r] |= oneButtonVerticalDebounce(_debounceMode, raw[r], _debounced[r], _cnt0[r], _cnt1[r]);
+    }
+  }  // _sample()
+
+
+  /**
+   * Block the new presses in all rows sharing 2 or more pressed columns with another row.
+   */
+  void _blockGhosts(uint32_t *raw) {
+    for (uint8_t a = 0; a < ROWS; a++) {
+      for (uint8_t b = a + 1; b < ROWS; b++) {
+        uint32_t common = raw[a] & raw[b];
+        if (common & (common - 1)) {
+          raw[a] &= _debounced[a];
+          raw[b] &= _debounced[b];
+          _ghosting = true;
+        }
+      }
+    }
+  }  // _blockGhosts()
+};
+
+#endif
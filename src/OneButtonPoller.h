@@ -0,0 +1,114 @@
+// -----
+// OneButtonPoller.h - Call tick() of several buttons at a high rate while they
+// are inside a press flow and at a low rate while they are idle. This class is
+// implemented for use with the Arduino environment.
+// Copyright (c) by Matthias Hertel, http://www.mathertel.de
+// This work is licensed under a BSD style license. See
+// http://www.mathertel.de/License.aspx More information on:
+// http://www.mathertel.de/Arduino
+// -----
+// 14.10.2026 created to reduce the polling costs of idle buttons.
+// -----
+
+#ifndef OneButtonPoller_h
+#define OneButtonPoller_h
+
+#include "OneButton.h"
+#include "OneButtonTiny.h"
+
+/**
+ * Tick up to N buttons of the class BUTTON (OneButton or OneButtonTiny) with an adaptive rate.
+ *
+ * Buttons reporting wantsFastTick() are ticked every fast interval, all other buttons only every slow interval.
+ * A press of an idle button is seen up to the slow interval later. As the debounce time starts
+ * with the first sample of the new level the timing of the press flow is not affected.
+ * Keep the slow interval below the debounce time of the buttons.
+ */
+template <class BUTTON, uint8_t N>
+class OneButtonPoller {
+public:
+  // ----- Set runtime parameters -----
+
+  /**
+   * Add a button.
+   * @return The index of the button or -1 when all buttons are used.
+   */
+  int add(BUTTON &button) {
+    if (_count == N) return -1;
+
+    _buttons[_count] = &button;
+    return _count++;
+  }  // add()
+
+
+  /**
+   * set # millisec between 2 ticks of a button inside a press flow.
+   */
+  void setFastMs(const unsigned int ms) {
+    _fast_ms = ms;
+  }
+
+  /**
+   * set # millisec between 2 ticks of an idle button.
+   */
+  void setSlowMs(const unsigned int ms) {
+    _slow_ms = ms;
+  }
+
+  // ----- State machine functions -----
+
+  /**
+   * @brief Call this function every loop, the buttons are ticked when their interval has passed.
+   */
+  void tick(void) {
+    unsigned long now = millis();
+    bool fast = ((now - _lastFastTime) >= _fast_ms);
+    bool slow = ((now - _lastSlowTime) >= _slow_ms);
+    if (!fast && !slow) return;
+
+    if (fast) _lastFastTime = now;
+    if (slow) _lastSlowTime = now;
+
+    for (uint8_t n = 0; n < _count; n++) {
+      BUTTON *btn = _buttons[n];
+      if (slow || btn->wantsFastTick()) btn->tick();
+    }
+  }  // tick()
+
+
+  /**
+   * @return true when any button is inside a press flow.
+   */
+  bool wantsFastTick() const {
+    for (uint8_t n = 0; n < _count; n++) {
+      if (_buttons[n]->wantsFastTick()) return true;
+    }
+    return false;
+  }
+
+  /**
+   * @return number of buttons.
+   */
+  uint8_t count() const {
+    return _count;
+  }
+
+  /**
+   * @return the button with the given index.
+   */
+  BUTTON *button(const uint8_t index) const {
+    return (index < _count) ? _buttons[index] : NULL;
+  }
+
+
+private:
+  BUTTON *_buttons[N];
+  uint8_t _count = 0;
+
+  unsigned int _fast_ms = 1;
+  unsigned int _slow_ms = 20;
+  unsigned long _lastFastTime = 0;
+  unsigned long _lastSlowTime = 0;
+};
+
+#endif
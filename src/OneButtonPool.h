@@ -0,0 +1,210 @@
+// -----
+// OneButtonPool.h - Create and remove buttons at runtime using a static pool
+// and tick all active buttons. This class is implemented for use with the
+// Arduino environment.
+// Copyright (c) by Matthias Hertel, http://www.mathertel.de
+// This work is licensed under a BSD style license. See
+// http://www.mathertel.de/License.aspx More information on:
+// http://www.mathertel.de/Arduino
+// -----
+// 14.10.2026 created for inputs that are reconfigured at runtime.
+// 14.10.2026 remove() releases the interrupt slots of the button.
+// -----
+
+#ifndef OneButtonPool_h
+#define OneButtonPool_h
+
+#include "OneButton.h"
+#include "OneButtonTiny.h"
+
+#if defined(__AVR__)
+#include <new.h>
+#else
+#include <new>
+#endif
+
+
+/**
+ * Registry of up to N buttons of the class BUTTON (OneButton or OneButtonTiny) created at runtime.
+ *
+ * The buttons are constructed in a static pool inside the registry, no heap memory is used.
+ * Free slots are kept in a free list and the buttons in use in a double linked active list so
+ * add() and remove() take constant time and tickAll() only visits the buttons in use.
+ * The links are stored in the slots next to the buttons: 2 bytes per slot.
+ *
+ * Buttons must not be added or removed inside the event functions called by tickAll().
+ * remove() and the destructor detach the pin change interrupt of a button and release its
+ * ISR slot and edge slot by detachInterupt(). Stop a OneButtonCapture of the button before removing it.
+ * @tparam BUTTON The class of the buttons.
+ * @tparam N max. number of buttons, up to 254.
+ */
+template <class BUTTON, uint8_t N>
+class OneButtonPool {
+  static_assert((N >= 1) && (N <= 254), "N must be 1..254");
+
+public:
+  // ----- Constructor -----
+
+  OneButtonPool() {
+    _head = _tail = NONE;
+    _free = 0;
+    for (uint8_t n = 0; n < N; n++) {
+      _slots[n].next = (n + 1 < N) ? n + 1 : NONE;
+      _slots[n].prev = FREE;
+    }
+  }
+
+  ~OneButtonPool() {
+    while (_head != NONE) remove(*_button(_head));
+  }
+
+  // ----- Add and remove buttons -----
+
+  /**
+   * Create a button in a free slot. It is ticked by tickAll() after the buttons added before.
+   * @param args The parameters of the constructor of the button, e.g. pin, activeLow and pullupActive.
+   * @return the button or NULL when all slots are used.
+   */
+  template <typename... Args>
+  BUTTON *add(Args... args) {
+    uint8_t n = _free;
+    if (n == NONE) return NULL;
+
+    _free = _slots[n].next;
+    BUTTON *button = new (_slots[n].data) BUTTON(args...);
+
+    // append to the active list.
+    _slots[n].prev = _tail;
+    _slots[n].next = NONE;
+    if (_tail == NONE) {
+      _head = n;
+    } else {
+      _slots[_tail].next = n;
+    }
+    _tail = n;
+    _count++;
+    return button;
+  }  // add()
+
+
+  /**
+   * Remove a button and destroy it. Pointers to the button are invalid afterwards.
+   * @return false when the button is not an active button of this pool.
+   */
+  bool remove(BUTTON &button) {
+    uint8_t n = _index(&button);
+    if (n == NONE) return false;
+
+    // unlink from the active list.
+    uint8_t prev = _slots[n].prev;
+    uint8_t next = _slots[n].next;
+    if (prev == NONE) {
+      _head = next;
+    } else {
+      _slots[prev].next = next;
+    }
+    if (next == NONE) {
+      _tail = prev;
+    } else {
+      _slots[next].prev = prev;
+    }
+
+    button.detachInterupt();
+    button.~BUTTON();
+
+    // push to the free list.
+    _slots[n].prev = FREE;
+    _slots[n].next = _free;
+    _free = n;
+    _count--;
+    return true;
+  }  // remove()
+
+
+  /**
+   * @return true when the button is an active button of this pool.
+   */
+  bool contains(const BUTTON &button) const {
+    return _index(&button) != NONE;
+  }
+
+  /**
+   * @return number of buttons in use.
+   */
+  uint8_t count() const {
+    return _count;
+  }
+
+  // ----- Iterate the active buttons -----
+
+  /**
+   * @return the first button in the order of adding or NULL when no button is in use.
+   */
+  BUTTON *first() const {
+    return (_head == NONE) ? NULL : _button(_head);
+  }
+
+  /**
+   * @return the button after the given one or NULL after the last button.
+   */
+  BUTTON *next(const BUTTON *button) const {
+    uint8_t n = _index(button);
+    return ((n == NONE) || (_slots[n].next == NONE)) ? NULL : _button(_slots[n].next);
+  }
+
+  // ----- State machine functions -----
+
+  /**
+   * @brief Call tick() of all active buttons.
+   */
+  void tickAll() {
+    for (uint8_t n = _head; n != NONE; n = _slots[n].next) _button(n)->tick();
+  }  // tickAll()
+
+
+  /**
+   * Calculate when any active button needs the next tick().
+   * @return msecs until the next timeout, 0 when tickAll() should be called immediately or
+   * ONEBUTTON_NO_DEADLINE when only a level change can advance any state machine.
+   */
+  unsigned long nextDeadlineMs() const {
+    unsigned long deadline = ONEBUTTON_NO_DEADLINE;
+    for (uint8_t n = _head; (n != NONE) && deadline; n = _slots[n].next) deadline = min(deadline, _button(n)->nextDeadlineMs());
+    return deadline;
+  }  // nextDeadlineMs()
+
+
+private:
+  static constexpr uint8_t NONE = 0xFF;  // end of a list
+  static constexpr uint8_t FREE = 0xFE;  // prev link of a slot in the free list
+
+  struct _Slot {
+    alignas(BUTTON) uint8_t data[sizeof(BUTTON)];  // storage of the button
+    uint8_t next;                                   // next slot in the active or free list
+    uint8_t prev;                                   // previous slot in the active list or FREE
+  };
+
+  _Slot _slots[N];
+  uint8_t _head;  // first active slot
+  uint8_t _tail;  // last active slot
+  uint8_t _free;  // first free slot
+  uint8_t _count = 0;
+
+  BUTTON *_button(const uint8_t n) const {
+    return (BUTTON *)(_slots[n].data);
+  }
+
+  // the slot of an active button of this pool or NONE.
+  uint8_t _index(const BUTTON *button) const {
+    uintptr_t p = (uintptr_t)button;
+    uintptr_t base = (uintptr_t)_slots;
+
+    if ((p < base) || (p >= base + sizeof(_slots))) return NONE;
+    uintptr_t offset = p - base;
+    if (offset % sizeof(_Slot)) return NONE;
+    uint8_t n = offset / sizeof(_Slot);
+    return (_slots[n].prev == FREE) ? NONE : n;
+  }
+};
+
+#endif
@@ -0,0 +1,94 @@
+/**
+ * @file OneButtonPower.cpp
+ *
+ * @brief Sleep while all registered buttons are idle.
+ *
+ * @author Matthias Hertel, https://www.mathertel.de
+ * @Copyright Copyright (c) by Matthias Hertel, https://www.mathertel.de.
+ *
+ * This work is licensed under a BSD style license. See
+ * http://www.mathertel.de/License.aspx
+ *
+ * More information on: https://www.mathertel.de/Arduino/OneButtonLibrary.aspx
+ *
+ * Changelog: see OneButtonPower.h
+ */
+
+#include "OneButtonPower.h"
+
+OneButton *OneButtonPower::_buttons[ONEBUTTON_POWER_SIZE];
+OneButtonTiny *OneButtonPower::_tinyButtons[ONEBUTTON_POWER_SIZE];
+uint8_t OneButtonPower::_count = 0;
+uint8_t OneButtonPower::_tinyCount = 0;
+bool OneButtonPower::_powerDown = true;
+
+
+#if defined(__AVR__)
+
+bool OneButtonPower::tick() {
+  // a pin change after this point prevents sleeping.
+  uint8_t count = OneButtonIsr::interruptCount();
+  _tickAll();
+
+  unsigned long deadline = nextDeadlineMs();
+  if (deadline == 0) return false;
+
+  // idle mode keeps Timer0 running for the timeouts and the press times, it wakes up every msec.
+  // A held button without a timeout has no deadline but its press time needs millis().
+  set_sleep_mode((_powerDown && isIdle()) ? SLEEP_MODE_PWR_DOWN : SLEEP_MODE_IDLE);
+
+  noInterrupts();
+  if (count != OneButtonIsr::interruptCount()) {
+    interrupts();
+    return false;
+  }
+  sleep_enable();
+#if defined(sleep_bod_disable)
+  sleep_bod_disable();
+#endif
+  interrupts();  // the next instruction is executed before any interrupt.
+  sleep_cpu();
+  sleep_disable();
+  return true;
+}
+
+
+#elif defined(ESP32)
+
+bool OneButtonPower::tick() {
+  _tickAll();
+
+  unsigned long deadline = nextDeadlineMs();
+  if (deadline == 0) return false;
+
+  // wake up when any pin leaves its current level. A level wakes up immediately when it already changed.
+  for (uint8_t n = 0; n < _count + _tinyCount; n++) {
+    int pin = (n < _count) ? _buttons[n]->pin() : _tinyButtons[n - _count]->pin();
+    gpio_wakeup_enable((gpio_num_t)pin, digitalRead(pin) ? GPIO_INTR_LOW_LEVEL : GPIO_INTR_HIGH_LEVEL);
+  }
+  esp_sleep_enable_gpio_wakeup();
+  if (deadline != ONEBUTTON_NO_DEADLINE) esp_sleep_enable_timer_wakeup(deadline * 1000ULL);
+
+  esp_light_sleep_start();
+
+  esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_ALL);
+  for (uint8_t n = 0; n < _count + _tinyCount; n++) {
+    int pin = (n < _count) ? _buttons[n]->pin() : _tinyButtons[n - _count]->pin();
+    gpio_wakeup_disable((gpio_num_t)pin);
+  }
+  return true;
+}
+
+
+#else
+
+// no sleep mode supported: only tick the buttons.
+bool OneButtonPower::tick() {
+  _tickAll();
+  return false;
+}
+
+#endif
+
+
+// end.
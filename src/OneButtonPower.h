@@ -0,0 +1,132 @@
+// -----
+// OneButtonPower.h - Put the processor to sleep while all registered buttons are
+// idle and wake it up by a pin change or the next timeout of a button.
+// This class is implemented for use with the Arduino environment.
+// Copyright (c) by Matthias Hertel, http://www.mathertel.de
+// This work is licensed under a BSD style license. See
+// http://www.mathertel.de/License.aspx More information on:
+// http://www.mathertel.de/Arduino
+// -----
+// 14.10.2026 created for battery powered devices.
+// 14.10.2026 static members and tick() moved to OneButtonPower.cpp.
+// 14.10.2026 power down only while all buttons are resting.
+// -----
+//
+// Sleep modes used:
+// * AVR: power down while all buttons are resting, idle while a timeout is pending or a button is pressed.
+//   The buttons are woken by the library owned pin change interrupts. millis() does not advance while
+//   powered down, the timing of the buttons is not affected as all of them are resting.
+//   The pin change that woke up the processor is seen by the next tick() and debounced from that time.
+// * ESP32: light sleep, woken by the opposite level of every button pin and by a timer for pending timeouts.
+//   millis() stays consistent as the RTC timer keeps running.
+// On other platforms tick() only ticks the buttons and returns false.
+
+#ifndef OneButtonPower_h
+#define OneButtonPower_h
+
+#include "OneButton.h"
+#include "OneButtonTiny.h"
+
+#if defined(__AVR__)
+#include <avr/sleep.h>
+#elif defined(ESP32)
+#include <esp_sleep.h>
+#include <driver/gpio.h>
+#endif
+
+// max. number of buttons of each class handled by the power manager.
+// The macro must be defined for all compiled files, e.g. by the build flags.
+#ifndef ONEBUTTON_POWER_SIZE
+#define ONEBUTTON_POWER_SIZE 8
+#endif
+
+
+class OneButtonPower {
+public:
+  /**
+   * Register a button. On AVR a library owned pin change interrupt is bound to the button
+   * when it has none so every pin change wakes up the processor.
+   * @return false when no more buttons can be registered or all ONEBUTTON_ISR_SLOTS are in use.
+   */
+  static bool add(OneButton &button) {
+    if ((_count == ONEBUTTON_POWER_SIZE) || (button.pin() < 0)) return false;
+#if defined(__AVR__)
+    if (!_attach(button)) return false;
+#endif
+    _buttons[_count++] = &button;
+    return true;
+  }
+
+  static bool add(OneButtonTiny &button) {
+    if (_tinyCount == ONEBUTTON_POWER_SIZE) return false;
+#if defined(__AVR__)
+    if (!_attach(button)) return false;
+#endif
+    _tinyButtons[_tinyCount++] = &button;
+    return true;
+  }
+
+  /**
+   * Allow the power down mode of AVR processors. Disable it when other peripherals like the Serial
+   * receiver must keep working or wake up the processor.
+   */
+  static void allowPowerDown(const bool allow) {
+    _powerDown = allow;
+  }
+
+  /**
+   * Calculate when any registered button needs the next tick().
+   * @return msecs until the next timeout, 0 when tick() should be called immediately or
+   * ONEBUTTON_NO_DEADLINE when only a level change can advance any state machine.
+   */
+  static unsigned long nextDeadlineMs() {
+    unsigned long deadline = ONEBUTTON_NO_DEADLINE;
+    for (uint8_t n = 0; (n < _count) && deadline; n++) deadline = min(deadline, _buttons[n]->nextDeadlineMs());
+    for (uint8_t n = 0; (n < _tinyCount) && deadline; n++) deadline = min(deadline, _tinyButtons[n]->nextDeadlineMs());
+    return deadline;
+  }
+
+  /**
+   * @return true when all registered buttons are resting: released, not debouncing and the idle event
+   * reported, so only a pin change can advance them and millis() may stop.
+   */
+  static bool isIdle() {
+    for (uint8_t n = 0; n < _count; n++) if (_buttons[n]->wantsFastTick()) return false;
+    for (uint8_t n = 0; n < _tinyCount; n++) if (_tinyButtons[n]->wantsFastTick()) return false;
+    return true;
+  }
+
+  /**
+   * Tick all registered buttons and sleep until the next timeout or pin change when possible.
+   * Call this instead of the tick() functions of the buttons at the end of loop().
+   * @return true when the processor was sleeping.
+   */
+  static bool tick();
+
+private:
+  static OneButton *_buttons[ONEBUTTON_POWER_SIZE];
+  static OneButtonTiny *_tinyButtons[ONEBUTTON_POWER_SIZE];
+  static uint8_t _count;
+  static uint8_t _tinyCount;
+  static bool _powerDown;
+
+  // bind a library owned ISR, the wake ups are only seen by OneButtonIsr::interruptCount().
+  template <class BUTTON>
+  static bool _attach(BUTTON &button) {
+    if (!button.isInteruptAttached()) {
+      button.attachInterupt();
+      if (!button.isInteruptAttached()) {
+        button.detachInterupt();
+        return false;
+      }
+    }
+    return true;
+  }
+
+  static void _tickAll() {
+    for (uint8_t n = 0; n < _count; n++) _buttons[n]->tick();
+    for (uint8_t n = 0; n < _tinyCount; n++) _tinyButtons[n]->tick();
+  }
+};
+
+#endif
@@ -0,0 +1,165 @@
+/**
+ * @file OneButtonScheduler.cpp
+ *
+ * @brief Timer interrupt calling tick() of all registered buttons.
+ *
+ * @author Matthias Hertel, https://www.mathertel.de
+ * @Copyright Copyright (c) by Matthias Hertel, https://www.mathertel.de.
+ *
+ * This work is licensed under a BSD style license. See
+ * http://www.mathertel.de/License.aspx
+ *
+ * More information on: https://www.mathertel.de/Arduino/OneButtonLibrary.aspx
+ *
+ * Changelog: see OneButtonScheduler.h
+ */
+
+#include "OneButtonScheduler.h"
+
+OneButton *volatile OneButtonScheduler::_buttons[ONEBUTTON_SCHEDULER_SIZE];
+OneButtonTiny *volatile OneButtonScheduler::_tinyButtons[ONEBUTTON_SCHEDULER_SIZE];
+volatile uint8_t OneButtonScheduler::_count = 0;
+volatile uint8_t OneButtonScheduler::_tinyCount = 0;
+bool OneButtonScheduler::_running = false;
+
+
+#if defined(__AVR__) && defined(TIMSK2)
+
+bool OneButtonScheduler::begin(const uint8_t periodMs) {
+  unsigned long ticks = (F_CPU / 1024UL) * periodMs / 1000UL;
+  if (ticks < 1) ticks = 1;
+  if (ticks > 256) ticks = 256;
+
+  noInterrupts();
+  TCCR2A = _BV(WGM21);                         // CTC mode
+  TCCR2B = _BV(CS22) | _BV(CS21) | _BV(CS20);  // prescaler 1024
+  TCNT2 = 0;
+  OCR2A = ticks - 1;
+  TIFR2 = _BV(OCF2A);
+  TIMSK2 |= _BV(OCIE2A);
+  interrupts();
+  _running = true;
+  return true;
+}
+
+void OneButtonScheduler::end() {
+  TIMSK2 &= ~_BV(OCIE2A);
+  _running = false;
+}
+
+void OneButtonScheduler::pause() {
+  TIMSK2 &= ~_BV(OCIE2A);
+}
+
+void OneButtonScheduler::resume() {
+  if (_running) TIMSK2 |= _BV(OCIE2A);
+}
+
+ISR(TIMER2_COMPA_vect) {
+  OneButtonScheduler::run();
+}
+
+
+#elif defined(ESP32)
+
+esp_timer_handle_t OneButtonScheduler::_timer = NULL;
+static SemaphoreHandle_t oneButtonSchedulerMutex = NULL;
+
+// runs in the esp_timer task, the mutex protects against concurrent access from loop().
+// It is recursive so the event functions can call pause() and resume().
+static void oneButtonSchedulerCallback(void *) {
+  xSemaphoreTakeRecursive(oneButtonSchedulerMutex, portMAX_DELAY);
+  OneButtonScheduler::run();
+  xSemaphoreGiveRecursive(oneButtonSchedulerMutex);
+}
+
+bool OneButtonScheduler::begin(const uint8_t periodMs) {
+  if (!oneButtonSchedulerMutex) oneButtonSchedulerMutex = xSemaphoreCreateRecursiveMutex();
+  if (!_timer) {
+    esp_timer_create_args_t args = {};
+    args.callback = oneButtonSchedulerCallback;
+    args.name = "OneButton";
+    if (esp_timer_create(&args, &_timer) != ESP_OK) return false;
+  }
+  _running = (esp_timer_start_periodic(_timer, periodMs * 1000ULL) == ESP_OK);
+  return _running;
+}
+
+void OneButtonScheduler::end() {
+  if (_timer) esp_timer_stop(_timer);
+  _running = false;
+}
+
+void OneButtonScheduler::pause() {
+  if (oneButtonSchedulerMutex) xSemaphoreTakeRecursive(oneButtonSchedulerMutex, portMAX_DELAY);
+}
+
+void OneButtonScheduler::resume() {
+  if (oneButtonSchedulerMutex) xSemaphoreGiveRecursive(oneButtonSchedulerMutex);
+}
+
+
+#elif defined(ARDUINO_ARCH_SAMD) && defined(GCLK_CLKCTRL_ID_TCC2_TC3)
+
+bool OneButtonScheduler::begin(const uint8_t periodMs) {
+  // clock TC3 by the 48 MHz generic clock 0.
+  GCLK->CLKCTRL.reg = GCLK_CLKCTRL_CLKEN | GCLK_CLKCTRL_GEN_GCLK0 | GCLK_CLKCTRL_ID_TCC2_TC3;
+  while (GCLK->STATUS.bit.SYNCBUSY) {}
+
+  TC3->COUNT16.CTRLA.reg = TC_CTRLA_SWRST;
+  while (TC3->COUNT16.CTRLA.bit.SWRST) {}
+
+  TC3->COUNT16.CTRLA.reg = TC_CTRLA_MODE_COUNT16 | TC_CTRLA_WAVEGEN_MFRQ | TC_CTRLA_PRESCALER_DIV1024;
+  TC3->COUNT16.CC[0].reg = (uint16_t)((F_CPU / 1024UL) * periodMs / 1000UL - 1);
+  while (TC3->COUNT16.STATUS.bit.SYNCBUSY) {}
+
+  TC3->COUNT16.INTENSET.reg = TC_INTENSET_MC0;
+  NVIC_EnableIRQ(TC3_IRQn);
+  TC3->COUNT16.CTRLA.reg |= TC_CTRLA_ENABLE;
+  while (TC3->COUNT16.STATUS.bit.SYNCBUSY) {}
+  _running = true;
+  return true;
+}
+
+void OneButtonScheduler::end() {
+  TC3->COUNT16.CTRLA.reg &= ~TC_CTRLA_ENABLE;
+  NVIC_DisableIRQ(TC3_IRQn);
+  _running = false;
+}
+
+void OneButtonScheduler::pause() {
+  NVIC_DisableIRQ(TC3_IRQn);
+}
+
+void OneButtonScheduler::resume() {
+  if (_running) NVIC_EnableIRQ(TC3_IRQn);
+}
+
+void TC3_Handler() {
+  TC3->COUNT16.INTFLAG.reg = TC_INTFLAG_MC0;
+  OneButtonScheduler::run();
+}
+
+
+#else
+
+// no hardware timer supported: call OneButtonScheduler::run() from your own timer.
+bool OneButtonScheduler::begin(const uint8_t periodMs) {
+  (void)periodMs;
+  return false;
+}
+
+void OneButtonScheduler::end() {}
+
+void OneButtonScheduler::pause() {
+  noInterrupts();
+}
+
+void OneButtonScheduler::resume() {
+  interrupts();
+}
+
+#endif
+
+
+// end.
@@ -0,0 +1,102 @@
+// -----
+// OneButtonScheduler.h - Call tick() of all registered buttons from a hardware
+// timer interrupt. This class is implemented for use with the Arduino environment.
+// Copyright (c) by Matthias Hertel, http://www.mathertel.de
+// This work is licensed under a BSD style license. See
+// http://www.mathertel.de/License.aspx More information on:
+// http://www.mathertel.de/Arduino
+// -----
+// 14.10.2026 created to make event detection independent of loop() latency.
+// 14.10.2026 static members and timer interrupt moved to OneButtonScheduler.cpp.
+// -----
+//
+// The timer interrupt routine is in OneButtonScheduler.cpp and is only linked into sketches
+// using the scheduler, so the timer stays available for tone() in all other sketches.
+//
+// Timers used:
+// * AVR: Timer2 in CTC mode (not available together with tone()). Max. period is 16 msecs at 16 MHz.
+// * ESP32: esp_timer, the buttons are ticked by the esp_timer task protected by a mutex.
+// * SAMD21: TC3.
+// On other platforms begin() returns false and run() can be called from your own timer.
+//
+// The event functions are called from the timer interrupt, so better use a OneButtonEventQueue.
+
+#ifndef OneButtonScheduler_h
+#define OneButtonScheduler_h
+
+#include "OneButton.h"
+#include "OneButtonTiny.h"
+
+#if defined(ESP32)
+#include <esp_timer.h>
+#endif
+
+// max. number of buttons of each class ticked by the scheduler.
+// The macro must be defined for all compiled files, e.g. by the build flags.
+#ifndef ONEBUTTON_SCHEDULER_SIZE
+#define ONEBUTTON_SCHEDULER_SIZE 8
+#endif
+
+
+class OneButtonScheduler {
+public:
+  /**
+   * Register a button to be ticked by the timer.
+   * @return false when no more buttons can be registered.
+   */
+  static bool add(OneButton &button) {
+    if (_count == ONEBUTTON_SCHEDULER_SIZE) return false;
+    pause();
+    _buttons[_count++] = &button;
+    resume();
+    return true;
+  }
+
+  static bool add(OneButtonTiny &button) {
+    if (_tinyCount == ONEBUTTON_SCHEDULER_SIZE) return false;
+    pause();
+    _tinyButtons[_tinyCount++] = &button;
+    resume();
+    return true;
+  }
+
+  /**
+   * Start the hardware timer.
+   * @param periodMs msecs between 2 ticks of all buttons.
+   * @return false when no hardware timer is supported on this platform.
+   */
+  static bool begin(const uint8_t periodMs = 5);
+
+  /**
+   * Stop the hardware timer.
+   */
+  static void end();
+
+  /**
+   * Block the timer interrupt while the main loop reads or modifies button data,
+   * e.g. when calling getPressedMs() or reset(). The event functions may also call them.
+   */
+  static void pause();
+  static void resume();
+
+  /**
+   * Tick all registered buttons. Called by the timer interrupt.
+   */
+  static void run() {
+    for (uint8_t n = 0; n < _count; n++) _buttons[n]->tick();
+    for (uint8_t n = 0; n < _tinyCount; n++) _tinyButtons[n]->tick();
+  }
+
+private:
+  static OneButton *volatile _buttons[ONEBUTTON_SCHEDULER_SIZE];
+  static OneButtonTiny *volatile _tinyButtons[ONEBUTTON_SCHEDULER_SIZE];
+  static volatile uint8_t _count;
+  static volatile uint8_t _tinyCount;
+  static bool _running;
+
+#if defined(ESP32)
+  static esp_timer_handle_t _timer;
+#endif
+};
+
+#endif
@@ -0,0 +1,167 @@
+// -----
+// OneButtonShared.h - Share the state and the events of a OneButton between the
+// core scanning the input and the core handling the events.
+// This class is implemented for use with the Arduino environment.
+// Copyright (c) by Matthias Hertel, http://www.mathertel.de
+// This work is licensed under a BSD style license. See
+// http://www.mathertel.de/License.aspx More information on:
+// http://www.mathertel.de/Arduino
+// -----
+// 14.10.2026 created for dual core processors like the ESP32 and RP2040.
+// 14.10.2026 isAttached() reports a conflict with attachEvent().
+// 14.10.2026 32 bit sequence counter on the 32 bit processors.
+// -----
+
+#ifndef OneButtonShared_h
+#define OneButtonShared_h
+
+#include "OneButtonEventQueue.h"
+
+// The sequence counter of the snapshot. 32 bits are read atomically on the dual core processors and
+// do not wrap around to the same value while a reader is copying.
+#if defined(__AVR__)
+typedef uint8_t onebutton_seq_t;
+#else
+typedef uint32_t onebutton_seq_t;
+#endif
+
+// ----- State snapshot -----
+
+struct oneButtonSnapshot_t {
+  bool idle;                // state machine is waiting for a press
+  bool longPressed;         // a long press was detected
+  bool pressed;             // debounced level is active
+  uint8_t clicks;           // number of clicks
+  unsigned long pressedMs;  // msecs since the press started while the button is pressed
+  unsigned long time;       // time of the tick that took the snapshot
+};
+
+
+/**
+ * Run the state machine of a button on one core and read its state and events on another core.
+ *
+ * The scanning core owns the button and calls tick() only. After every tick a snapshot of the state is
+ * published using a sequence lock: the sequence counter is odd while the snapshot is written and the
+ * reader repeats its copy until it saw the same even counter before and after copying.
+ * The events are passed by the lock free event queue.
+ * No interrupts are disabled and no mutex is taken so the scanning core is never blocked by the
+ * application core.
+ *
+ * All other functions are called by the application core.
+ * The event functions attached to the button are called on the scanning core, use pop() instead.
+ * The reader must not interrupt the scanning code on the same core as it would wait forever.
+ * @tparam N size of the event queue, a power of 2 up to 128.
+ */
+template <uint8_t N>
+class OneButtonShared : public OneButtonEventQueue<N> {
+public:
+  /**
+   * @param button The button, all its events are sent to the queue.
+   * The queue uses the attachEvent() function of the button, see isAttached().
+   */
+  explicit OneButtonShared(OneButton &button)
+    : _button(button) {
+    _attached = this->attach(button);
+  }
+
+  /**
+   * @return false when the events are not sent to the queue because another function was attached
+   * by attachEvent() of the button before.
+   */
+  bool isAttached() const {
+    return _attached;
+  }
+
+  // ----- Scanning core -----
+
+  /**
+   * @brief Call this function every some milliseconds on the scanning core.
+   * @return the events detected in this tick.
+   */
+  uint8_t tick(void) {
+    uint8_t events = _button.tick();
+    publish();
+    return events;
+  }  // tick()
+
+
+  /**
+   * Publish the state of the button. Call it after ticking the button in another way.
+   */
+  void publish() {
+    onebutton_seq_t seq = _seq;
+
+    _seq = seq + 1;  // odd: writing
+    ONEBUTTON_MEMORY_BARRIER();
+    _snapshot.idle = _button.isIdle();
+    _snapshot.longPressed = _button.isLongPressed();
+    _snapshot.pressed = _button.debouncedValue();
+    _snapshot.clicks = _button.getNumberClicks();
+    _snapshot.pressedMs = (_snapshot.pressed && !_snapshot.idle) ? _button.getPressedMs() : 0;
+    _snapshot.time = _button.getTickMs();
+    ONEBUTTON_MEMORY_BARRIER();
+    _seq = seq + 2;  // even: complete
+  }  // publish()
+
+  // ----- Application core -----
+
+  /**
+   * Copy a consistent snapshot of the state published by the last tick().
+   */
+  void read(oneButtonSnapshot_t &snapshot) const {
+    onebutton_seq_t seq;
+
+    do {
+      seq = _seq;
+      ONEBUTTON_MEMORY_BARRIER();
+      snapshot = _snapshot;
+      ONEBUTTON_MEMORY_BARRIER();
+    } while ((seq & 1) || (seq != _seq));
+  }  // read()
+
+
+  /**
+   * @return true when the state machine was waiting for a press.
+   */
+  bool isIdle() const {
+    oneButtonSnapshot_t s;
+    read(s);
+    return s.idle;
+  }
+
+  /**
+   * @return true when a long press was detected.
+   */
+  bool isLongPressed() const {
+    oneButtonSnapshot_t s;
+    read(s);
+    return s.longPressed;
+  }
+
+  /**
+   * @return number of clicks of the current or last click sequence.
+   */
+  int getNumberClicks() const {
+    oneButtonSnapshot_t s;
+    read(s);
+    return s.clicks;
+  }
+
+  /**
+   * @return msecs since the press started as seen by the last tick() or 0 when not pressed.
+   */
+  unsigned long getPressedMs() const {
+    oneButtonSnapshot_t s;
+    read(s);
+    return s.pressedMs;
+  }
+
+
+private:
+  OneButton &_button;
+  oneButtonSnapshot_t _snapshot = {};
+  volatile onebutton_seq_t _seq = 0;  // sequence counter, odd while the snapshot is written
+  bool _attached;
+};
+
+#endif
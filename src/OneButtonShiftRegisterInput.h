@@ -0,0 +1,87 @@
+// -----
+// OneButtonShiftRegisterInput.h - Input backend for a OneButtonGroup reading the
+// buttons from a chain of 74HC165 shift registers using SPI.
+// This class is implemented for use with the Arduino environment.
+// Copyright (c) by Matthias Hertel, http://www.mathertel.de
+// This work is licensed under a BSD style license. See
+// http://www.mathertel.de/License.aspx More information on:
+// http://www.mathertel.de/Arduino
+// -----
+// 14.10.2026 created to read many buttons in one SPI transfer.
+// -----
+
+#ifndef OneButtonShiftRegisterInput_h
+#define OneButtonShiftRegisterInput_h
+
+#include <SPI.h>
+#include "OneButtonGroup.h"
+
+#ifndef ONEBUTTON_SHIFT_CLOCK
+#define ONEBUTTON_SHIFT_CLOCK 4000000
+#endif
+
+/**
+ * Read up to N buttons from a chain of 74HC165 shift registers.
+ *
+ * The inputs are loaded with the SH/LD pin and all bytes of the chain are read in one SPI transfer.
+ * The QH output of the first register is connected to MISO, the clock input to SCK and CLK INH to GND.
+ * The button n of the group is the input n % 8 (A=0 ... H=7) of the register n / 8 counted from MISO.
+ *
+ * The 74HC165 does not release MISO so other SPI devices need a separate bus or a buffer.
+ */
+template <uint8_t N>
+class OneButtonShiftRegisterInput {
+public:
+  /**
+   * Initialize the load pin and the SPI bus.
+   * @param loadPin The pin connected to SH/LD of all registers.
+   * @param spi The SPI bus connected to the registers.
+   */
+  void begin(const uint8_t loadPin, SPIClass &spi = SPI) {
+    _loadPin = loadPin;
+    _spi = &spi;
+    pinMode(_loadPin, OUTPUT);
+    digitalWrite(_loadPin, HIGH);
+    _spi->begin();
+  }  // begin()
+
+
+  /**
+   * The buttons are created without a pin, the index in the group is the input number.
+   */
+  bool add(const uint8_t n, const int pin) {
+    (void)n;
+    (void)pin;
+    return true;
+  }  // add()
+
+
+  /**
+   * Load all inputs and read the whole chain in one SPI transfer.
+   */
+  void read(uint32_t *levels, const uint8_t count) {
+    uint8_t data[BYTES] = {};
+    uint8_t bytes = (count + 7) / 8;
+
+    digitalWrite(_loadPin, LOW);
+    digitalWrite(_loadPin, HIGH);
+
+    _spi->beginTransaction(SPISettings(ONEBUTTON_SHIFT_CLOCK, MSBFIRST, SPI_MODE0));
+    _spi->transfer(data, bytes);
+    _spi->endTransaction();
+
+    for (uint8_t b = 0; b < bytes; b++) {
+      if (b % 4 == 0) levels[b / 4] = 0;
+      levels[b / 4] |= (uint32_t)data[b] << (8 * (b % 4));
+    }
+  }  // read()
+
+
+private:
+  static constexpr uint8_t BYTES = (N + 7) / 8;
+
+  uint8_t _loadPin = 0;
+  SPIClass *_spi = NULL;
+};
+
+#endif
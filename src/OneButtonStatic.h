@@ -0,0 +1,317 @@
+// -----
+// OneButtonStatic.h - Library for detecting button clicks, doubleclicks and long
+// press pattern on a single button with a compile time configuration.
+// This class is implemented for use with the Arduino environment.
+// Copyright (c) by Matthias Hertel, http://www.mathertel.de
+// This work is licensed under a BSD style license. See
+// http://www.mathertel.de/License.aspx More information on:
+// http://www.mathertel.de/Arduino
+// -----
+// 14.10.2026 created for flash limited environments like attiny85.
+// 14.10.2026 state machine shared with the other button classes, see OneButtonFsm.
+// 14.10.2026 tick(level, now) with a time sampled once per scan.
+// 14.10.2026 port and bit of the pin resolved at compile time on AVR.
+// -----
+
+#ifndef OneButtonStatic_h
+#define OneButtonStatic_h
+
+#include "OneButtonFsm.h"
+
+// The Arduino pin map of the AVR processors where the port register and bit of a pin are
+// resolved at compile time. Other processors use the port register looked up by the constructor.
+#if defined(__AVR_ATmega328P__) || defined(__AVR_ATmega328__) || defined(__AVR_ATmega168P__) || defined(__AVR_ATmega168__) \
+  || defined(__AVR_ATmega88P__) || defined(__AVR_ATmega88__) || defined(__AVR_ATmega48P__) || defined(__AVR_ATmega48__)
+#define ONEBUTTON_STATIC_PORTMAP 1  // pins 0..7 on PIND, 8..13 on PINB, 14..19 on PINC
+#elif defined(__AVR_ATtiny85__) || defined(__AVR_ATtiny45__) || defined(__AVR_ATtiny25__)
+#define ONEBUTTON_STATIC_PORTMAP 2  // pins 0..5 on PINB
+#else
+#define ONEBUTTON_STATIC_PORTMAP 0
+#endif
+
+/**
+ * A button with pin, timing and the set of supported events given at compile time.
+ *
+ * All timing comparisons use constants and the code and callback storage for events
+ * not included in EventMask is removed by the compiler.
+ * Timestamps are stored with 16 bits so all times must be below 65 seconds.
+ *
+ * On the ATmega328P family and the ATtiny85 family the port and bit of the pin are constants and tick() reads
+ * the input by a single instruction without RAM for the register. On other AVR processors and the other cores the
+ * port register and mask are looked up by the constructor and stored in the instance, without port registers digitalRead()
+ * is used.
+ *
+ * Example: OneButtonStatic<2, true, 50, 400, 800, OBM_CLICK | OBM_LONGPRESSSTART> button;
+ *
+ * @tparam Pin The pin to be used for input from a momentary button.
+ * @tparam ActiveLow true when the input level is LOW when the button is pressed.
+ * @tparam DebounceMs msecs a level has to be stable.
+ * @tparam ClickMs msecs after single click is assumed.
+ * @tparam PressMs msecs after press is assumed.
+ * @tparam EventMask The events supported, any combination of the OBM_XXX values.
+ * @tparam IdleMs msecs after idle is assumed.
+ * @tparam LongPressIntervalMs msecs between calls of the DuringLongPress event.
+ */
+template <uint8_t Pin, bool ActiveLow = true, uint16_t DebounceMs = 50, uint16_t ClickMs = 400, uint16_t PressMs = 800,
+          uint8_t EventMask = OBM_ALL, uint16_t IdleMs = 1000, uint16_t LongPressIntervalMs = 0>
+class OneButtonStatic {
+public:
+  // ----- Constructor -----
+
+  /**
+   * Create a OneButtonStatic instance.
+   * use setup(...) to initialize the hardware.
+   */
+  OneButtonStatic() {}
+
+  /**
+   * Create a OneButtonStatic instance and setup the pin.
+   * @param pullupActive Activate the internal pullup when available.
+   */
+  explicit OneButtonStatic(const bool pullupActive) {
+    setup(pullupActive ? INPUT_PULLUP : INPUT);
+  }
+
+  /**
+   * Initialize or re-initialize the input pin.
+   * @param mode Any of the modes also used in pinMode like INPUT or INPUT_PULLUP (default).
+   */
+  void setup(const uint8_t mode = INPUT_PULLUP) {
+    pinMode(Pin, mode);
+  }
+
+  // ----- Attach events functions -----
+
+  /**
+   * Attach a function to one of the events. The event must be part of EventMask.
+   * @tparam Event The event.
+   * @param newFunction This function will be called when the event has been detected.
+   */
+  template <oneButtonEvent_t Event>
+  void attach(callbackFunction newFunction) {
+    static_assert(EventMask & (1 << Event), "event not enabled in EventMask");
+    _funcs[_index(Event)] = newFunction;
+  }
+
+  void attachPress(callbackFunction newFunction) {
+    attach<OBE_PRESS>(newFunction);
+  }
+  void attachClick(callbackFunction newFunction) {
+    attach<OBE_CLICK>(newFunction);
+  }
+  void attachDoubleClick(callbackFunction newFunction) {
+    attach<OBE_DOUBLECLICK>(newFunction);
+  }
+  void attachMultiClick(callbackFunction newFunction) {
+    attach<OBE_MULTICLICK>(newFunction);
+  }
+  void attachLongPressStart(callbackFunction newFunction) {
+    attach<OBE_LONGPRESSSTART>(newFunction);
+  }
+  void attachLongPressStop(callbackFunction newFunction) {
+    attach<OBE_LONGPRESSSTOP>(newFunction);
+  }
+  void attachDuringLongPress(callbackFunction newFunction) {
+    attach<OBE_DURINGLONGPRESS>(newFunction);
+  }
+  void attachIdle(callbackFunction newFunction) {
+    attach<OBE_IDLE>(newFunction);
+  }
+
+  // ----- State machine functions -----
+
+  /**
+   * @brief Call this function every some milliseconds for checking the input
+   * level at the configured pin.
+   */
+  void tick(void) {
+    bool level = _readPin();
+    tick(ActiveLow ? !level : level);
+  }
+
+  /**
+   * @brief Run the finite state machine (FSM) using the given level.
+   */
+  void tick(bool activeLevel) {
+    tick(activeLevel, millis());
+  }
+
+  /**
+   * @brief Run the finite state machine (FSM) using the given level and time.
+   * @param activeLevel true when the button is pressed.
+   * @param now current time in msecs as returned by millis().
+   */
+  void tick(bool activeLevel, unsigned long now) {
+    uint16_t t = (uint16_t)now;
+    _fsm(_debounce(activeLevel, t), t);
+  }
+
+  /**
+   * Reset the button state machine.
+   */
+  void reset(void) {
+    _setState(OCS_INIT);
+    _nClicks = 0;
+    _startTime = (uint16_t)millis();
+  }
+
+  /**
+   * @return number of clicks in any case: single or multiple clicks
+   */
+  uint8_t getNumberClicks(void) const {
+    return _nClicks;
+  }
+
+  /**
+   * @return true if we are currently handling button press flow
+   */
+  bool isIdle() const {
+    return _getState() == OCS_INIT;
+  }
+
+  /**
+   * @return true when a long press is detected
+   */
+  bool isLongPressed() const {
+    return _getState() == OCS_PRESS;
+  }
+
+
+private:
+  // events requiring the long press states.
+  static constexpr bool HAS_LONGPRESS = EventMask & (OBM_LONGPRESSSTART | OBM_LONGPRESSSTOP | OBM_DURINGLONGPRESS);
+
+  // max number of clicks of interest.
+  static constexpr uint8_t MAX_CLICKS = (EventMask & OBM_MULTICLICK) ? 100 : (EventMask & OBM_DOUBLECLICK) ? 2 : 1;
+
+  // number of callback slots required.
+  static constexpr uint8_t _count(uint8_t mask) {
+    return mask ? (mask & 1) + _count(mask >> 1) : 0;
+  }
+
+  // the index of the callback slot of an event.
+  static constexpr uint8_t _index(uint8_t event) {
+    return _count(EventMask & ((1 << event) - 1));
+  }
+
+  static constexpr uint8_t FUNC_COUNT = _count(EventMask);
+
+  // define FiniteStateMachine
+  enum stateMachine_t : uint8_t {
+    OCS_INIT = OBS_INIT,
+    OCS_DOWN = OBS_DOWN,    // button is down
+    OCS_UP = OBS_UP,        // button is up
+    OCS_COUNT = OBS_COUNT,  // in multi press-mode, counting
+    OCS_PRESS = OBS_PRESS,  // button is hold down
+    OCS_PRESSEND = OBS_PRESSEND,
+  };
+
+  // Packed flags byte: [idle:1][lastLevel:1][debouncedLevel:1][state:3]
+  static constexpr uint8_t FLAG_IDLE = 0x80;
+  static constexpr uint8_t FLAG_LAST_LEVEL = 0x40;
+  static constexpr uint8_t FLAG_DEBOUNCED = 0x20;
+  static constexpr uint8_t STATE_MASK = 0x07;
+
+  callbackFunction _funcs[FUNC_COUNT ? FUNC_COUNT : 1] = {};
+
+#if (ONEBUTTON_STATIC_PORTMAP == 1)
+  static_assert(Pin < 20, "Pin must be 0..19");
+  static constexpr uint8_t PIN_MASK = 1 << ((Pin < 8) ? Pin : (Pin < 14) ? (Pin - 8) : (Pin - 14));
+
+  bool _readPin() const {
+    return ((Pin < 8) ? PIND : (Pin < 14) ? PINB : PINC) & PIN_MASK;
+  }
+
+#elif (ONEBUTTON_STATIC_PORTMAP == 2)
+  static_assert(Pin < 6, "Pin must be 0..5");
+  static constexpr uint8_t PIN_MASK = 1 << Pin;
+
+  bool _readPin() const {
+    return PINB & PIN_MASK;
+  }
+
+#elif defined(portInputRegister)
+  // initialized by the constructors so tick() can read the pin before setup() is called.
+  decltype(portInputRegister(0)) _inputRegister = portInputRegister(digitalPinToPort(Pin));
+  decltype(digitalPinToBitMask(0)) _mask = digitalPinToBitMask(Pin);
+
+  bool _readPin() const {
+    return *_inputRegister & _mask;
+  }
+
+#else
+  bool _readPin() const {
+    return digitalRead(Pin);
+  }
+#endif
+
+  uint16_t _startTime = 0;                // start time of current activeLevel change
+  uint16_t _lastDebounceTime = 0;         // start time of the last raw level
+  uint16_t _lastDuringLongPressTime = 0;  // used to produce the DuringLongPress interval
+  uint8_t _nClicks = 0;                   // count the number of clicks
+  uint8_t _flags = 0;
+
+  void _setState(const stateMachine_t s) {
+    _flags = (_flags & ~STATE_MASK) | s;
+  }
+  stateMachine_t _getState() const {
+    return (stateMachine_t)(_flags & STATE_MASK);
+  }
+
+  void _setFlag(const uint8_t flag, const bool v) {
+    if (v) {
+      _flags |= flag;
+    } else {
+      _flags &= ~flag;
+    }
+  }
+
+  // call the function of an event when it is enabled and attached.
+  void _fire(const oneButtonEvent_t event) {
+    if (EventMask & (1 << event)) {
+      callbackFunction f = _funcs[_index(event)];
+      if (f) f();
+    }
+  }
+
+  bool _debounce(const bool level, const uint16_t now) {
+    if (((_flags & FLAG_LAST_LEVEL) != 0) == level) {
+      if ((uint16_t)(now - _lastDebounceTime) >= DebounceMs) _setFlag(FLAG_DEBOUNCED, level);
+    } else {
+      _lastDebounceTime = now;
+      _setFlag(FLAG_LAST_LEVEL, level);
+    }
+    return _flags & FLAG_DEBOUNCED;
+  }
+
+  // ----- storage of the state machine, see OneButtonFsm -----
+
+  typedef OneButtonFsm<uint16_t, 0> fsm_t;
+  friend fsm_t;
+
+  uint8_t _fsmState() const { return _getState(); }
+  void _fsmSetState(const uint8_t s) { _setState((stateMachine_t)s); }
+  uint8_t _fsmClicks() const { return _nClicks; }
+  void _fsmSetClicks(const uint8_t c) { _nClicks = c; }
+  uint16_t _fsmStartTime() const { return _startTime; }
+  void _fsmSetStartTime(const uint16_t t) { _startTime = t; }
+  uint16_t _fsmPressTime() const { return PressMs; }
+  uint16_t _fsmClickTime() const { return ClickMs; }
+  uint16_t _fsmIdleTime() const { return IdleMs; }
+  uint8_t _fsmMaxClicks() const { return MAX_CLICKS; }
+  bool _fsmHasLongPress() const { return HAS_LONGPRESS; }
+  bool _fsmWaitsIdle() const { return (EventMask & OBM_IDLE) && !(_flags & FLAG_IDLE); }
+  void _fsmSetIdle(const bool fired) { _setFlag(FLAG_IDLE, fired); }
+  bool _fsmHasDuringLongPress() const { return EventMask & OBM_DURINGLONGPRESS; }
+  uint16_t _fsmDuringTime() const { return _lastDuringLongPressTime; }
+  void _fsmSetDuringTime(const uint16_t t) { _lastDuringLongPressTime = t; }
+  uint16_t _fsmDuringInterval() const { return LongPressIntervalMs; }
+  void _fsmPressing(const uint16_t) {}
+  void _fsmFire(const oneButtonEvent_t event) { _fire(event); }
+
+  void _fsm(const bool activeLevel, const uint16_t now) {
+    fsm_t::run(*this, activeLevel, now);
+  }  // _fsm()
+};
+
+#endif
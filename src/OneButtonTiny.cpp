@@ -15,14 +15,13 @@
 
 #include "OneButtonTiny.h"
 
-// ISR callback defaults (static - shared across all instances)
-void (*OneButtonTiny::isrCallback)() = OneButtonTiny::isrDefaultUnused;
+// default of attachInterupt(): no user function
 void OneButtonTiny::isrDefaultUnused() { /* NOP */ }
 
 
 // ----- Constructor -----
 OneButtonTiny::OneButtonTiny(const uint8_t pin, const bool activeLow, const bool pullupActive) 
-    : _pin(pin), _flags(0), _state(OCS_INIT)
+    : _pin(pin), _flags(0)
 {
   // Set active level polarity in flags
   if (activeLow) {
@@ -52,6 +51,12 @@ void OneButtonTiny::setPressMs(const uint16_t ms) {
   _press_ms = ms;
 }
 
+#if (ONEBUTTON_TINY_FEATURES & OBT_IDLE)
+void OneButtonTiny::setIdleMs(const uint16_t ms) {
+  _idle_ms = ms;
+}
+#endif
+
 
 // ----- Callback attachment -----
 
@@ -67,12 +72,81 @@ void OneButtonTiny::attachLongPressStart(callbackFunction newFunction) {
   _longPressStartFunc = newFunction;
 }
 
+#if (ONEBUTTON_TINY_FEATURES & OBT_LONGPRESSSTOP)
+void OneButtonTiny::attachLongPressStop(callbackFunction newFunction) {
+  _longPressStopFunc = newFunction;
+}
+#endif
+
+#if (ONEBUTTON_TINY_FEATURES & OBT_DURINGLONGPRESS)
+void OneButtonTiny::attachDuringLongPress(callbackFunction newFunction) {
+  _duringLongPressFunc = newFunction;
+}
+#endif
+
+#if (ONEBUTTON_TINY_FEATURES & OBT_MULTICLICK)
+void OneButtonTiny::attachMultiClick(callbackFunction newFunction) {
+  _multiClickFunc = newFunction;
+}
+#endif
+
+#if (ONEBUTTON_TINY_FEATURES & OBT_IDLE)
+void OneButtonTiny::attachIdle(callbackFunction newFunction) {
+  _idleFunc = newFunction;
+}
+#endif
+
+#if (ONEBUTTON_TINY_FEATURES & OBT_DELEGATES)
+void OneButtonTiny::attachClick(const OneButtonDelegate &delegate) {
+  _clickFunc = delegate;
+}
+
+void OneButtonTiny::attachDoubleClick(const OneButtonDelegate &delegate) {
+  _doubleClickFunc = delegate;
+}
+
+void OneButtonTiny::attachLongPressStart(const OneButtonDelegate &delegate) {
+  _longPressStartFunc = delegate;
+}
+
+#if (ONEBUTTON_TINY_FEATURES & OBT_LONGPRESSSTOP)
+void OneButtonTiny::attachLongPressStop(const OneButtonDelegate &delegate) {
+  _longPressStopFunc = delegate;
+}
+#endif
+
+#if (ONEBUTTON_TINY_FEATURES & OBT_DURINGLONGPRESS)
+void OneButtonTiny::attachDuringLongPress(const OneButtonDelegate &delegate) {
+  _duringLongPressFunc = delegate;
+}
+#endif
+
+#if (ONEBUTTON_TINY_FEATURES & OBT_MULTICLICK)
+void OneButtonTiny::attachMultiClick(const OneButtonDelegate &delegate) {
+  _multiClickFunc = delegate;
+}
+#endif
+
+#if (ONEBUTTON_TINY_FEATURES & OBT_IDLE)
+void OneButtonTiny::attachIdle(const OneButtonDelegate &delegate) {
+  _idleFunc = delegate;
+}
+#endif
+#endif
+
 
 // ----- Interrupt support -----
 
+// bind a library owned ISR to this instance, it marks the button as changed and calls the user function.
 void OneButtonTiny::attachInterupt(uint8_t mode, void (*userFunc)(void)) {
-  attachPinChangeInterrupt(digitalPinToPinChangeInterrupt(_pin), userFunc, mode);
-  isrCallback = userFunc;
+  _isrSlot = OneButtonIsr::attach(NULL, this, (userFunc == isrDefaultUnused) ? NULL : userFunc);
+
+  if (_isrSlot == OneButtonIsr::NO_SLOT) {
+    // all slots are used: call the user function directly, tick() reads the pin every time.
+    attachPinChangeInterrupt(digitalPinToPinChangeInterrupt(_pin), userFunc, mode);
+  } else {
+    attachPinChangeInterrupt(digitalPinToPinChangeInterrupt(_pin), OneButtonIsr::isr(_isrSlot), mode);
+  }
 }
 
 void OneButtonTiny::enableInterupt() {
@@ -83,20 +157,35 @@ void OneButtonTiny::disableInterupt() {
   disablePinChangeInterrupt(digitalPinToPinChangeInterrupt(_pin));
 }
 
+// release the library owned ISR so other buttons can use it.
+void OneButtonTiny::detachInterupt() {
+  detachPinChangeInterrupt(digitalPinToPinChangeInterrupt(_pin));
+  OneButtonIsr::detach(_isrSlot);
+  _isrSlot = OneButtonIsr::NO_SLOT;
+}
+
 
 // ----- State machine -----
 
 void OneButtonTiny::reset(void) {
   _setState(OCS_INIT);
   _setClicks(0);
-  _startTime = 0;
-  _state = OCS_INIT;  // Keep legacy var in sync
+  _startTime = _now();
+#if (ONEBUTTON_TINY_FEATURES & OBT_IDLE)
+  _idleState = false;
+#endif
 }
 
 
-bool OneButtonTiny::_debounce(bool level) {
-  uint16_t now = _now();
-  
+bool OneButtonTiny::_debounce(bool level, uint16_t now) {
+#if (ONEBUTTON_TINY_DEBOUNCE == OBD_LOCKOUT)
+  // accept a change immediately when the last change is longer ago than the debounce time.
+  _setLastLevel(level);
+  if ((_getDebouncedLevel() != level) && ((uint16_t)(now - _lastDebounceTime) >= (uint8_t)(_debounce_ms >> 2))) {
+    _setDebouncedLevel(level);
+    _lastDebounceTime = now;
+  }
+#else
   if (_getLastLevel() == level) {
     // Level unchanged - check if debounce time elapsed
     if ((uint16_t)(now - _lastDebounceTime) >= (uint8_t)(_debounce_ms >> 2)) {
@@ -107,96 +196,90 @@ bool OneButtonTiny::_debounce(bool level) {
     _lastDebounceTime = now;
     _setLastLevel(level);
   }
+#endif
   return _getDebouncedLevel();
 }
 
 
+unsigned long OneButtonTiny::nextDeadlineMs() const {
+  uint16_t now = _now();
+  unsigned long deadline = ONEBUTTON_NO_DEADLINE;
+
+  if (_getLastLevel() != _getDebouncedLevel()) {
+    // a level change is waiting to become stable.
+    deadline = fsm_t::remainingMs(_lastDebounceTime, _debounce_ms >> 2, now);
+  }
+
+  return min(deadline, fsm_t::nextDeadlineMs(*this, now));
+}
+
+
 void OneButtonTiny::tick(void) {
+  // with a bound ISR a resting button without a pin change needs no work.
+  if ((_isrSlot != OneButtonIsr::NO_SLOT) && !OneButtonIsr::takePending(_isrSlot) && _isResting()) return;
+
   // Read pin and check if it matches the "pressed" level
   bool rawLevel = digitalRead(_pin);
   bool activeLevel = _getButtonPressed() ? rawLevel : !rawLevel;
-  _fsm(_debounce(activeLevel));
+  uint16_t now = _now();
+  _fsm(_debounce(activeLevel, now), now);
 }
 
 
 void OneButtonTiny::tick(bool activeLevel) {
-  _fsm(_debounce(activeLevel));
+  tick(activeLevel, millis());
 }
 
 
-void OneButtonTiny::_fsm(bool activeLevel) {
-  uint16_t now = _now();
-  uint16_t waitTime = (now - _startTime) << 2;  // Convert back to ms
-  stateMachine_t currentState = _getState();
-
-  switch (currentState) {
-    case OCS_INIT:
-      // Waiting for button press
-      if (activeLevel) {
-        _setState(OCS_DOWN);
-        _startTime = now;
-        _setClicks(0);
-      }
-      break;
+void OneButtonTiny::tick(bool activeLevel, unsigned long now) {
+  uint16_t t = _time(now);
+  _fsm(_debounce(activeLevel, t), t);
+}
 
-    case OCS_DOWN:
-      // Button is down, waiting for release or long press timeout
-      if (!activeLevel) {
-        // Button released
-        _setState(OCS_UP);
-        _startTime = now;
-      } else if (waitTime > _press_ms) {
-        // Long press detected
-        if (_longPressStartFunc) _longPressStartFunc();
-        _setState(OCS_PRESS);
-      }
-      break;
 
-    case OCS_UP:
-      // Button just released - count the click
-      _setClicks(_getClicks() + 1);
-      _setState(OCS_COUNT);
-      break;
+// call the function attached to an event, the disabled events are removed by the compiler.
+inline void OneButtonTiny::_fsmFire(const oneButtonEvent_t event) {
+  oneButtonTinyCallback_t fn = {};
 
-    case OCS_COUNT:
-      // Debounce complete, counting clicks
-      if (activeLevel) {
-        // Button pressed again (for double-click detection)
-        _setState(OCS_DOWN);
-        _startTime = now;
-      } else if (waitTime >= _click_ms || _getClicks() >= 2) {
-        // Timeout or max clicks reached - fire callback
-        uint8_t clicks = _getClicks();
-        if (clicks == 1 && _clickFunc) {
-          _clickFunc();
-        } else if (clicks >= 2 && _doubleClickFunc) {
-          _doubleClickFunc();
-        }
-        reset();
-      }
+  switch (event) {
+    case OBE_CLICK:
+      fn = _clickFunc;
       break;
-
-    case OCS_PRESS:
-      // In long press state, waiting for release
-      if (!activeLevel) {
-        _setState(OCS_PRESSEND);
-        _startTime = now;
-      }
+    case OBE_DOUBLECLICK:
+      fn = _doubleClickFunc;
       break;
-
-    case OCS_PRESSEND:
-      // Long press ended
-      reset();
+    case OBE_LONGPRESSSTART:
+      fn = _longPressStartFunc;
       break;
-
+#if (ONEBUTTON_TINY_FEATURES & OBT_MULTICLICK)
+    case OBE_MULTICLICK:
+      fn = _multiClickFunc;
+      break;
+#endif
+#if (ONEBUTTON_TINY_FEATURES & OBT_LONGPRESSSTOP)
+    case OBE_LONGPRESSSTOP:
+      fn = _longPressStopFunc;
+      break;
+#endif
+#if (ONEBUTTON_TINY_FEATURES & OBT_DURINGLONGPRESS)
+    case OBE_DURINGLONGPRESS:
+      fn = _duringLongPressFunc;
+      break;
+#endif
+#if (ONEBUTTON_TINY_FEATURES & OBT_IDLE)
+    case OBE_IDLE:
+      fn = _idleFunc;
+      break;
+#endif
     default:
-      // Unknown state - reset
-      reset();
       break;
   }
-  
-  // Keep legacy _state in sync
-  _state = _getState();
+  if (fn) fn();
+}
+
+
+void OneButtonTiny::_fsm(bool activeLevel, uint16_t now) {
+  fsm_t::run(*this, activeLevel, now);
 }
 
 // end.
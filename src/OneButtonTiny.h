@@ -8,6 +8,17 @@
 // -----
 // 01.12.2023 created from OneButtonTiny to support tiny environments.
 // 02.2026 RAM optimized: reduced from ~36 bytes to ~22 bytes per instance
+// 14.10.2026 nextDeadlineMs() added for sleeping until the next timeout.
+// 14.10.2026 tick(level, now) with a time sampled once per scan.
+// 14.10.2026 optional events selected by ONEBUTTON_TINY_FEATURES.
+// 14.10.2026 legacy _state removed, the state is kept in the packed flags only.
+// 14.10.2026 attachInterupt() binds the interrupt to the instance.
+// 14.10.2026 wantsFastTick() for adaptive tick rates.
+// 14.10.2026 isInteruptAttached() for the power manager.
+// 14.10.2026 lockout debouncing selected by ONEBUTTON_TINY_DEBOUNCE.
+// 14.10.2026 state machine shared with the other button classes, see OneButtonFsm.
+// 14.10.2026 member function callbacks by OneButtonDelegate selected by OBT_DELEGATES.
+// 14.10.2026 detachInterupt() releases the interrupt slot.
 // -----
 
 #ifndef OneButtonTiny_h
@@ -15,12 +26,45 @@
 
 #include "Arduino.h"
 #include <PinChangeInterrupt.h>
+#include "OneButtonTypes.h"
+#include "OneButtonIsr.h"
+#include "OneButtonFsm.h"
+
+template <uint8_t N>
+class OneButtonTinyArray;
+
+// ----- Optional events -----
+
+// Set ONEBUTTON_TINY_FEATURES to a combination of these bits to add events to OneButtonTiny.
+// Only the selected events cost RAM and flash memory.
+#define OBT_LONGPRESSSTOP 0x01    // attachLongPressStop()
+#define OBT_DURINGLONGPRESS 0x02  // attachDuringLongPress()
+#define OBT_MULTICLICK 0x04       // attachMultiClick() and getNumberClicks()
+#define OBT_IDLE 0x08             // attachIdle() and setIdleMs()
+#define OBT_ALL 0x0F
+#define OBT_DELEGATES 0x10        // attach functions for OneButtonDelegate, 2 more bytes per event function on AVR
+
+#ifndef ONEBUTTON_TINY_FEATURES
+#define ONEBUTTON_TINY_FEATURES 0
+#endif
 
-// ----- Callback function types -----
+// Set ONEBUTTON_TINY_DEBOUNCE to OBD_LOCKOUT to accept a press immediately and ignore further level
+// changes for the debounce time. The default OBD_STABLE waits until the level was stable for the debounce time.
+// OBD_INTEGRATOR needs more RAM and is only available in OneButton.
+#ifndef ONEBUTTON_TINY_DEBOUNCE
+#define ONEBUTTON_TINY_DEBOUNCE OBD_STABLE
+#endif
 
-extern "C" {
-  typedef void (*callbackFunction)(void);
-}
+#if (ONEBUTTON_TINY_DEBOUNCE != OBD_STABLE) && (ONEBUTTON_TINY_DEBOUNCE != OBD_LOCKOUT)
+#error "ONEBUTTON_TINY_DEBOUNCE must be OBD_STABLE or OBD_LOCKOUT"
+#endif
+
+// The stored event functions: plain function pointers or delegates with OBT_DELEGATES.
+#if (ONEBUTTON_TINY_FEATURES & OBT_DELEGATES)
+typedef OneButtonDelegate oneButtonTinyCallback_t;
+#else
+typedef callbackFunction oneButtonTinyCallback_t;
+#endif
 
 
 class OneButtonTiny {
@@ -50,6 +94,13 @@ public:
    */
   void setPressMs(const uint16_t ms);
 
+#if (ONEBUTTON_TINY_FEATURES & OBT_IDLE)
+  /**
+   * set # millisec after idle is assumed.
+   */
+  void setIdleMs(const uint16_t ms);
+#endif
+
   // ----- Attach events functions -----
 
   /**
@@ -70,8 +121,66 @@ public:
    */
   void attachLongPressStart(callbackFunction newFunction);
 
+#if (ONEBUTTON_TINY_FEATURES & OBT_LONGPRESSSTOP)
+  /**
+   * Attach an event to fire when the button is released after a long hold.
+   * @param newFunction
+   */
+  void attachLongPressStop(callbackFunction newFunction);
+#endif
+
+#if (ONEBUTTON_TINY_FEATURES & OBT_DURINGLONGPRESS)
+  /**
+   * Attach an event to fire periodically while the button is held down.
+   * @param newFunction
+   */
+  void attachDuringLongPress(callbackFunction newFunction);
+#endif
+
+#if (ONEBUTTON_TINY_FEATURES & OBT_MULTICLICK)
+  /**
+   * Attach an event to be called after a multi click is detected.
+   * The double click is then detected after the click time has passed.
+   * @param newFunction This function will be called when the event has been detected.
+   */
+  void attachMultiClick(callbackFunction newFunction);
+#endif
+
+#if (ONEBUTTON_TINY_FEATURES & OBT_IDLE)
+  /**
+   * Attach an event when the button is in idle position.
+   * @param newFunction
+   */
+  void attachIdle(callbackFunction newFunction);
+#endif
+
+#if (ONEBUTTON_TINY_FEATURES & OBT_DELEGATES)
+  /**
+   * Attach a member function of an object or any other delegate to an event, see OneButtonDelegate.
+   * Example: button.attachClick(ONEBUTTON_DELEGATE(this, &Menu::next));
+   * @param delegate This delegate will be called when the event has been detected.
+   */
+  void attachClick(const OneButtonDelegate &delegate);
+  void attachDoubleClick(const OneButtonDelegate &delegate);
+  void attachLongPressStart(const OneButtonDelegate &delegate);
+#if (ONEBUTTON_TINY_FEATURES & OBT_LONGPRESSSTOP)
+  void attachLongPressStop(const OneButtonDelegate &delegate);
+#endif
+#if (ONEBUTTON_TINY_FEATURES & OBT_DURINGLONGPRESS)
+  void attachDuringLongPress(const OneButtonDelegate &delegate);
+#endif
+#if (ONEBUTTON_TINY_FEATURES & OBT_MULTICLICK)
+  void attachMultiClick(const OneButtonDelegate &delegate);
+#endif
+#if (ONEBUTTON_TINY_FEATURES & OBT_IDLE)
+  void attachIdle(const OneButtonDelegate &delegate);
+#endif
+#endif
+
   /**
    * Attach an interrupt to be called immediately when a pin change is detected.
+   * The library owned ISR of the button marks the button as changed so tick() can skip reading
+   * the pin while the button is resting. Up to ONEBUTTON_ISR_SLOTS buttons can be bound this way.
    * @param mode Interrupt mode (e.g. CHANGE)
    * @param userFunc Function to call on interrupt. If omitted a default no-op is used.
    */
@@ -83,6 +192,15 @@ public:
   /** Disable pin-change interrupt for the configured pin. */
   void disableInterupt();
 
+  /**
+   * Detach the pin change interrupt and release the ISR slot of the button.
+   * Call it before a button with an interrupt is destroyed.
+   */
+  void detachInterupt();
+
+  /** @return true when a library owned ISR is bound by attachInterupt(). */
+  bool isInteruptAttached() const { return _isrSlot != OneButtonIsr::NO_SLOT; }
+
   // ----- State machine functions -----
 
   /**
@@ -99,6 +217,14 @@ public:
    */
   void tick(bool level);
 
+  /**
+   * @brief Run the finite state machine (FSM) using the given level and time.
+   * Sample millis() once per scan and pass it to all buttons.
+   * @param level true when the button is pressed.
+   * @param now current time in msecs as returned by millis().
+   */
+  void tick(bool level, unsigned long now);
+
 
   /**
    * Reset the button state machine.
@@ -111,11 +237,38 @@ public:
    * (This allows power sensitive applications to know when it is safe to power down the main CPU)
    */
   bool isIdle() const {
-    return _state == OCS_INIT;
+    return _getState() == OCS_INIT;
+  }
+
+  /**
+   * @return true when the button is debouncing or inside a press flow and tick() should be called
+   * at a high rate. When false the button only waits for a level change and can be ticked less often.
+   */
+  bool wantsFastTick() const {
+    return !_isResting();
   }
 
+  /**
+   * Calculate when the state machine needs the next tick() to detect a timeout based event.
+   * @return msecs until the next timeout, 0 when tick() should be called immediately or
+   * ONEBUTTON_NO_DEADLINE when only a level change can advance the state machine.
+   */
+  unsigned long nextDeadlineMs() const;
+
+#if (ONEBUTTON_TINY_FEATURES & OBT_MULTICLICK)
+  /**
+   * @return number of clicks in any case: single or multiple clicks.
+   */
+  uint8_t getNumberClicks(void) const {
+    return _getClicks();
+  }
+#endif
+
 
 private:
+  template <uint8_t N>
+  friend class OneButtonTinyArray;
+
   // ===== Optimized member layout for minimal RAM =====
   // Timing values stored in reduced precision where possible
   
@@ -124,13 +277,30 @@ private:
   uint16_t _startTime = 0;     // 2 bytes - stored as (millis() >> 2) for 4ms resolution, ~262s range
   uint16_t _lastDebounceTime = 0; // 2 bytes - stored as (millis() >> 2)
 
-  // Function pointers - 2 bytes each on AVR
-  callbackFunction _clickFunc = nullptr;        // 2 bytes
-  callbackFunction _doubleClickFunc = nullptr;  // 2 bytes  
-  callbackFunction _longPressStartFunc = nullptr; // 2 bytes
+  // Function pointers - 2 bytes each on AVR, 4 bytes each with OBT_DELEGATES
+  oneButtonTinyCallback_t _clickFunc = {};           // 2 bytes
+  oneButtonTinyCallback_t _doubleClickFunc = {};     // 2 bytes
+  oneButtonTinyCallback_t _longPressStartFunc = {};  // 2 bytes
+
+#if (ONEBUTTON_TINY_FEATURES & OBT_LONGPRESSSTOP)
+  oneButtonTinyCallback_t _longPressStopFunc = {};
+#endif
+#if (ONEBUTTON_TINY_FEATURES & OBT_DURINGLONGPRESS)
+  oneButtonTinyCallback_t _duringLongPressFunc = {};
+#endif
+#if (ONEBUTTON_TINY_FEATURES & OBT_MULTICLICK)
+  oneButtonTinyCallback_t _multiClickFunc = {};
+  uint8_t _nClicks = 0;        // 1 byte - click count beyond the 2 bits in _flags
+#endif
+#if (ONEBUTTON_TINY_FEATURES & OBT_IDLE)
+  oneButtonTinyCallback_t _idleFunc = {};
+  uint16_t _idle_ms = 1000;    // 2 bytes - msecs before idle is detected
+  bool _idleState = false;     // 1 byte - idle event was fired
+#endif
 
   uint8_t _pin;                // 1 byte - hardware pin number (0-255 is plenty)
   uint8_t _debounce_ms = 50;   // 1 byte - debounce time (max 255ms is plenty)
+  uint8_t _isrSlot = OneButtonIsr::NO_SLOT;  // 1 byte - slot of the library owned ISR
   
   // Packed flags byte: [buttonPressed:1][lastLevel:1][debouncedLevel:1][state:3][nClicks:2]
   // state uses 3 bits (0-7), nClicks uses 2 bits (0-3)
@@ -144,54 +314,104 @@ private:
   static constexpr uint8_t STATE_SHIFT         = 2;
   static constexpr uint8_t CLICKS_MASK         = 0x03;  // bits 1-0: click count (0-3)
 
-  // ISR callback support (static - shared across all instances)
+  // default of attachInterupt(): no user function
   static void isrDefaultUnused();
-  static void (*isrCallback)();
 
   // define FiniteStateMachine
   enum stateMachine_t : uint8_t {
-    OCS_INIT = 0,
-    OCS_DOWN = 1,  // button is down
-    OCS_UP = 2,    // button is up
-    OCS_COUNT = 3,
-    OCS_PRESS = 4,  // button is hold down (changed from 6 to fit in 3 bits)
-    OCS_PRESSEND = 5,
+    OCS_INIT = OBS_INIT,
+    OCS_DOWN = OBS_DOWN,  // button is down
+    OCS_UP = OBS_UP,      // button is up
+    OCS_COUNT = OBS_COUNT,
+    OCS_PRESS = OBS_PRESS,  // button is hold down (fits in 3 bits)
+    OCS_PRESSEND = OBS_PRESSEND,
   };
 
   // Inline helpers for packed flags
   inline void _setState(stateMachine_t s) { _flags = (_flags & ~STATE_MASK) | ((s << STATE_SHIFT) & STATE_MASK); }
   inline stateMachine_t _getState() const { return static_cast<stateMachine_t>((_flags & STATE_MASK) >> STATE_SHIFT); }
+#if (ONEBUTTON_TINY_FEATURES & OBT_MULTICLICK)
+  inline void _setClicks(uint8_t c) { _nClicks = c; }
+  inline uint8_t _getClicks() const { return _nClicks; }
+  inline uint8_t _maxClicks() const { return _multiClickFunc ? 0xFF : 2; }
+#else
   inline void _setClicks(uint8_t c) { _flags = (_flags & ~CLICKS_MASK) | (c & CLICKS_MASK); }
   inline uint8_t _getClicks() const { return _flags & CLICKS_MASK; }
+  inline uint8_t _maxClicks() const { return 2; }
+#endif
   inline bool _getButtonPressed() const { return _flags & FLAG_BUTTON_PRESSED; }
   inline bool _getLastLevel() const { return _flags & FLAG_LAST_LEVEL; }
   inline void _setLastLevel(bool v) { if(v) _flags |= FLAG_LAST_LEVEL; else _flags &= ~FLAG_LAST_LEVEL; }
   inline bool _getDebouncedLevel() const { return _flags & FLAG_DEBOUNCED; }
   inline void _setDebouncedLevel(bool v) { if(v) _flags |= FLAG_DEBOUNCED; else _flags &= ~FLAG_DEBOUNCED; }
+
+  // no level change is pending and only a level change can advance the state machine.
+  inline bool _isResting() const {
+    return (_getState() == OCS_INIT) && (_getLastLevel() == _getDebouncedLevel())
+#if (ONEBUTTON_TINY_FEATURES & OBT_IDLE)
+           && (_idleState || !_idleFunc)
+#endif
+      ;
+  }
   
+  // ----- storage of the state machine, see OneButtonFsm -----
+
+  typedef OneButtonFsm<uint16_t, 2> fsm_t;
+  friend fsm_t;
+
+  uint8_t _fsmState() const { return _getState(); }
+  void _fsmSetState(const uint8_t s) { _setState((stateMachine_t)s); }
+  uint8_t _fsmClicks() const { return _getClicks(); }
+  void _fsmSetClicks(const uint8_t c) { _setClicks(c); }
+  uint16_t _fsmStartTime() const { return _startTime; }
+  void _fsmSetStartTime(const uint16_t t) { _startTime = t; }
+  uint16_t _fsmPressTime() const { return _press_ms >> 2; }
+  uint16_t _fsmClickTime() const { return _click_ms >> 2; }
+  uint8_t _fsmMaxClicks() const { return _maxClicks(); }
+  bool _fsmHasLongPress() const { return true; }
+#if (ONEBUTTON_TINY_FEATURES & OBT_IDLE)
+  uint16_t _fsmIdleTime() const { return _idle_ms >> 2; }
+  bool _fsmWaitsIdle() const { return _idleFunc && !_idleState; }
+  void _fsmSetIdle(const bool fired) { _idleState = fired; }
+#else
+  uint16_t _fsmIdleTime() const { return 0; }
+  bool _fsmWaitsIdle() const { return false; }
+  void _fsmSetIdle(const bool) {}
+#endif
+#if (ONEBUTTON_TINY_FEATURES & OBT_DURINGLONGPRESS)
+  bool _fsmHasDuringLongPress() const { return static_cast<bool>(_duringLongPressFunc); }
+#else
+  bool _fsmHasDuringLongPress() const { return false; }
+#endif
+  // the DuringLongPress function is called on every tick.
+  uint16_t _fsmDuringTime() const { return 0; }
+  void _fsmSetDuringTime(const uint16_t) {}
+  uint16_t _fsmDuringInterval() const { return 0; }
+  void _fsmPressing(const uint16_t) {}
+  void _fsmFire(const oneButtonEvent_t event);
+
   // Time helpers - store time with 4ms resolution to fit in uint16_t
-  inline uint16_t _now() const { return (uint16_t)(millis() >> 2); }
-  inline uint16_t _elapsed(uint16_t start) const { return (_now() - start) << 2; } // Convert back to ms
+  static inline uint16_t _now() { return _time(millis()); }
+  static inline uint16_t _time(unsigned long ms) { return (uint16_t)(ms >> 2); }
 
   /**
-   * Run the finite state machine (FSM) using the given level.
+   * Run the finite state machine (FSM) using the given level and (4 msec) time.
    */
-  void _fsm(bool activeLevel);
+  void _fsm(bool activeLevel, uint16_t now);
 
   /**
    * Debounce helper - returns true if level is stable
    */
-  bool _debounce(bool level);
-
-  // Legacy compatibility
-  stateMachine_t _state = OCS_INIT;  // Keep for compatibility, synced with packed state
+  bool _debounce(bool level, uint16_t now);
 
 public:
   uint8_t pin() const { return _pin; }
   stateMachine_t state() const { return _getState(); }
 };
 
-// Total RAM per instance: ~22 bytes (down from ~36)
-// 2+2+2+2 + 2+2+2 + 1+1+1+1 = 18 bytes + padding = ~20-22 bytes
+// Total RAM per instance on AVR: 18 bytes (down from ~36)
+// 2+2+2+2 + 2+2+2 + 1+1+1+1 = 18 bytes, the state is kept in the packed flags only.
+// Use OneButtonTinyArray for many buttons with the same configuration.
+// + 2 bytes per optional event function and 1..3 bytes for multi click and idle, see ONEBUTTON_TINY_FEATURES
 
 #endif
@@ -0,0 +1,371 @@
+// -----
+// OneButtonTinyArray.h - Library for detecting button clicks, doubleclicks and
+// long press pattern on many buttons with the same configuration using minimal
+// RAM. This class is implemented for use with the Arduino environment.
+// Copyright (c) by Matthias Hertel, http://www.mathertel.de
+// This work is licensed under a BSD style license. See
+// http://www.mathertel.de/License.aspx More information on:
+// http://www.mathertel.de/Arduino
+// -----
+// 14.10.2026 created to store many OneButtonTiny buttons in parallel arrays.
+// 14.10.2026 buttons without a pin for matrix keypads.
+// 14.10.2026 state machine shared with the other button classes, see OneButtonFsm.
+// -----
+
+#ifndef OneButtonTinyArray_h
+#define OneButtonTinyArray_h
+
+#include "OneButtonTiny.h"
+
+// ----- Callback function type -----
+
+extern "C" {
+  typedef void (*indexCallbackFunction)(uint8_t index);
+}
+
+
+/**
+ * Up to N buttons with the events of the OneButtonTiny class stored in parallel arrays.
+ *
+ * The timing configuration and the event functions are shared by all buttons.
+ * The event functions get the index of the button as parameter.
+ * Per button only the pin, the packed flags and 2 timestamps with 4 msec resolution are stored: 6 bytes.
+ *
+ * The OBT_LONGPRESSSTOP and OBT_DURINGLONGPRESS features of ONEBUTTON_TINY_FEATURES are supported
+ * as they do not need memory per button.
+ */
+template <uint8_t N>
+class OneButtonTinyArray {
+public:
+  // ----- Constructor -----
+
+  OneButtonTinyArray() {}
+
+  // ----- Set runtime parameters -----
+
+  /**
+   * Add a button.
+   * @param pin The pin to be used for input from a momentary button.
+   * @param activeLow Set to true when the input level is LOW when the button is pressed, Default is true.
+   * @param pullupActive Activate the internal pullup when available. Default is true.
+   * @return The index of the button or -1 when all buttons are used.
+   */
+  int add(const uint8_t pin, const bool activeLow = true, const bool pullupActive = true) {
+    if (_count == N) return -1;
+
+    uint8_t n = _count++;
+    _pin[n] = pin;
+    _flags[n] = activeLow ? 0 : FLAG_BUTTON_PRESSED;
+    _startTime[n] = _lastDebounceTime[n] = 0;
+    pinMode(pin, pullupActive ? INPUT_PULLUP : INPUT);
+    return n;
+  }  // add()
+
+
+  /**
+   * Add a button without a pin. Its level must be given by tick(index, level, now).
+   * @return The index of the button or -1 when all buttons are used.
+   */
+  int add() {
+    if (_count == N) return -1;
+
+    uint8_t n = _count++;
+    _pin[n] = NO_PIN;
+    _flags[n] = 0;
+    _startTime[n] = _lastDebounceTime[n] = 0;
+    return n;
+  }  // add()
+
+
+  /**
+   * set # millisec after safe click is assumed. 0 accepts every level change immediately.
+   */
+  void setDebounceMs(const uint8_t ms) {
+    _debounce_ms = ms;
+  }
+
+  /**
+   * set # millisec after single click is assumed.
+   */
+  void setClickMs(const uint16_t ms) {
+    _click_ms = ms;
+  }
+
+  /**
+   * set # millisec after press is assumed.
+   */
+  void setPressMs(const uint16_t ms) {
+    _press_ms = ms;
+  }
+
+  // ----- Attach events functions -----
+
+  /**
+   * Attach an event to be called when a single click is detected.
+   * @param newFunction This function will be called with the index of the button.
+   */
+  void attachClick(indexCallbackFunction newFunction) {
+    _clickFunc = newFunction;
+  }
+
+  /**
+   * Attach an event to be called after a double click is detected.
+   * @param newFunction This function will be called with the index of the button.
+   */
+  void attachDoubleClick(indexCallbackFunction newFunction) {
+    _doubleClickFunc = newFunction;
+  }
+
+  /**
+   * Attach an event to fire when the button is pressed and held down.
+   * @param newFunction This function will be called with the index of the button.
+   */
+  void attachLongPressStart(indexCallbackFunction newFunction) {
+    _longPressStartFunc = newFunction;
+  }
+
+#if (ONEBUTTON_TINY_FEATURES & OBT_LONGPRESSSTOP)
+  /**
+   * Attach an event to fire when the button is released after a long hold.
+   * @param newFunction This function will be called with the index of the button.
+   */
+  void attachLongPressStop(indexCallbackFunction newFunction) {
+    _longPressStopFunc = newFunction;
+  }
+#endif
+
+#if (ONEBUTTON_TINY_FEATURES & OBT_DURINGLONGPRESS)
+  /**
+   * Attach an event to fire on every tick while the button is held down.
+   * @param newFunction This function will be called with the index of the button.
+   */
+  void attachDuringLongPress(indexCallbackFunction newFunction) {
+    _duringLongPressFunc = newFunction;
+  }
+#endif
+
+  // ----- State machine functions -----
+
+  /**
+   * @brief Call this function every some milliseconds for checking all buttons.
+   */
+  void tick(void) {
+    tickAll(millis());
+  }  // tick()
+
+
+  /**
+   * @brief Check the pins of all buttons using a time sampled once per scan.
+   * @param now current time in msecs as returned by millis().
+   */
+  void tickAll(const unsigned long now) {
+    uint16_t t = OneButtonTiny::_time(now);
+    for (uint8_t n = 0; n < _count; n++) {
+      if (_pin[n] == NO_PIN) continue;
+      bool level = digitalRead(_pin[n]);
+      _step(n, (_flags[n] & FLAG_BUTTON_PRESSED) ? level : !level, t);
+    }
+  }  // tickAll()
+
+
+  /**
+   * @brief Run the state machine of one button using the given level and time.
+   * @param index The index of the button.
+   * @param level true when the button is pressed.
+   * @param now current time in msecs as returned by millis().
+   */
+  void tick(const uint8_t index, const bool level, const unsigned long now) {
+    if (index < _count) _step(index, level, OneButtonTiny::_time(now));
+  }  // tick()
+
+
+  /**
+   * Reset the state machine of one button.
+   */
+  void reset(const uint8_t index) {
+    _setState(index, OneButtonTiny::OCS_INIT);
+    _setClicks(index, 0);
+  }
+
+
+  /**
+   * @return true when the button is not handling a press flow.
+   */
+  bool isIdle(const uint8_t index) const {
+    return _getState(index) == OneButtonTiny::OCS_INIT;
+  }
+
+  /**
+   * @return true when the button is debouncing or inside a press flow and should be ticked at a high rate.
+   */
+  bool wantsFastTick(const uint8_t index) const {
+    uint8_t flags = _flags[index];
+    return (_getState(index) != OneButtonTiny::OCS_INIT) || (!(flags & FLAG_LAST_LEVEL) != !(flags & FLAG_DEBOUNCED));
+  }
+
+  /**
+   * Calculate when the buttons need the next tick() to detect a timeout based event.
+   * @return msecs until the next timeout, 0 when tick() should be called immediately or
+   * ONEBUTTON_NO_DEADLINE when only a level change can advance a state machine.
+   */
+  unsigned long nextDeadlineMs() const {
+    uint16_t now = OneButtonTiny::_now();
+    unsigned long deadline = ONEBUTTON_NO_DEADLINE;
+
+    for (uint8_t n = 0; n < _count; n++) {
+      uint8_t flags = _flags[n];
+
+      if (!(flags & FLAG_LAST_LEVEL) != !(flags & FLAG_DEBOUNCED)) {
+        // a level change is waiting to become stable.
+        deadline = min(deadline, fsm_t::remainingMs(_lastDebounceTime[n], _debounce_ms >> 2, now));
+      }
+
+      deadline = min(deadline, fsm_t::nextDeadlineMs(_Key<const OneButtonTinyArray>{ *this, n }, now));
+    }
+    return deadline;
+  }  // nextDeadlineMs()
+
+
+  /**
+   * @return number of buttons.
+   */
+  uint8_t count() const {
+    return _count;
+  }
+
+  /**
+   * @return the pin of the button with the given index or NO_PIN.
+   */
+  uint8_t pin(const uint8_t index) const {
+    return _pin[index];
+  }
+
+
+  static constexpr uint8_t NO_PIN = 0xFF;
+
+private:
+  // same flag layout as OneButtonTiny: [buttonPressed:1][lastLevel:1][debouncedLevel:1][state:3][nClicks:2]
+  static constexpr uint8_t FLAG_BUTTON_PRESSED = 0x80;
+  static constexpr uint8_t FLAG_LAST_LEVEL = 0x40;
+  static constexpr uint8_t FLAG_DEBOUNCED = 0x20;
+  static constexpr uint8_t STATE_MASK = 0x1C;
+  static constexpr uint8_t STATE_SHIFT = 2;
+  static constexpr uint8_t CLICKS_MASK = 0x03;
+
+  typedef OneButtonTiny::stateMachine_t stateMachine_t;
+
+  // shared configuration
+  uint16_t _click_ms = 400;
+  uint16_t _press_ms = 800;
+  uint8_t _debounce_ms = 50;
+  uint8_t _count = 0;
+
+  // shared event functions
+  indexCallbackFunction _clickFunc = NULL;
+  indexCallbackFunction _doubleClickFunc = NULL;
+  indexCallbackFunction _longPressStartFunc = NULL;
+#if (ONEBUTTON_TINY_FEATURES & OBT_LONGPRESSSTOP)
+  indexCallbackFunction _longPressStopFunc = NULL;
+#endif
+#if (ONEBUTTON_TINY_FEATURES & OBT_DURINGLONGPRESS)
+  indexCallbackFunction _duringLongPressFunc = NULL;
+#endif
+
+  // per button data
+  uint16_t _startTime[N];         // stored as (millis() >> 2)
+  uint16_t _lastDebounceTime[N];  // stored as (millis() >> 2)
+  uint8_t _flags[N];
+  uint8_t _pin[N];
+
+  inline void _setState(const uint8_t n, const stateMachine_t s) { _flags[n] = (_flags[n] & ~STATE_MASK) | ((s << STATE_SHIFT) & STATE_MASK); }
+  inline stateMachine_t _getState(const uint8_t n) const { return static_cast<stateMachine_t>((_flags[n] & STATE_MASK) >> STATE_SHIFT); }
+  inline void _setClicks(const uint8_t n, const uint8_t c) { _flags[n] = (_flags[n] & ~CLICKS_MASK) | (c & CLICKS_MASK); }
+  inline uint8_t _getClicks(const uint8_t n) const { return _flags[n] & CLICKS_MASK; }
+
+  typedef OneButtonFsm<uint16_t, 2> fsm_t;
+
+  // one button as the storage of the state machine, see OneButtonFsm.
+  template <class A>
+  struct _Key {
+    A &a;
+    const uint8_t n;
+
+    uint8_t _fsmState() const { return a._getState(n); }
+    void _fsmSetState(const uint8_t s) { a._setState(n, (stateMachine_t)s); }
+    uint8_t _fsmClicks() const { return a._getClicks(n); }
+    void _fsmSetClicks(const uint8_t c) { a._setClicks(n, c); }
+    uint16_t _fsmStartTime() const { return a._startTime[n]; }
+    void _fsmSetStartTime(const uint16_t t) { a._startTime[n] = t; }
+    uint16_t _fsmPressTime() const { return a._press_ms >> 2; }
+    uint16_t _fsmClickTime() const { return a._click_ms >> 2; }
+    uint16_t _fsmIdleTime() const { return 0; }
+    uint8_t _fsmMaxClicks() const { return 2; }
+    bool _fsmHasLongPress() const { return true; }
+    bool _fsmWaitsIdle() const { return false; }
+    void _fsmSetIdle(const bool) {}
+#if (ONEBUTTON_TINY_FEATURES & OBT_DURINGLONGPRESS)
+    bool _fsmHasDuringLongPress() const { return a._duringLongPressFunc; }
+#else
+    bool _fsmHasDuringLongPress() const { return false; }
+#endif
+    // the DuringLongPress function is called on every tick.
+    uint16_t _fsmDuringTime() const { return 0; }
+    void _fsmSetDuringTime(const uint16_t) {}
+    uint16_t _fsmDuringInterval() const { return 0; }
+    void _fsmPressing(const uint16_t) {}
+    void _fsmFire(const oneButtonEvent_t event) { a._fire(n, event); }
+  };
+
+  // call the shared function of an event with the index of the button.
+  void _fire(const uint8_t n, const oneButtonEvent_t event) {
+    indexCallbackFunction fn = NULL;
+
+    switch (event) {
+      case OBE_CLICK:
+        fn = _clickFunc;
+        break;
+      case OBE_DOUBLECLICK:
+      case OBE_MULTICLICK:
+        fn = _doubleClickFunc;
+        break;
+      case OBE_LONGPRESSSTART:
+        fn = _longPressStartFunc;
+        break;
+#if (ONEBUTTON_TINY_FEATURES & OBT_LONGPRESSSTOP)
+      case OBE_LONGPRESSSTOP:
+        fn = _longPressStopFunc;
+        break;
+#endif
+#if (ONEBUTTON_TINY_FEATURES & OBT_DURINGLONGPRESS)
+      case OBE_DURINGLONGPRESS:
+        fn = _duringLongPressFunc;
+        break;
+#endif
+      default:
+        break;
+    }
+    if (fn) fn(n);
+  }
+
+  /**
+   * Debounce the level and run the state machine of one button.
+   */
+  void _step(const uint8_t n, const bool level, const uint16_t now) {
+    uint8_t flags = _flags[n];
+
+    // debounce
+    if (!(flags & FLAG_LAST_LEVEL) != !level) {
+      _lastDebounceTime[n] = now;
+      flags ^= FLAG_LAST_LEVEL;
+    }
+    if ((uint16_t)(now - _lastDebounceTime[n]) >= (uint8_t)(_debounce_ms >> 2)) {
+      flags = level ? (flags | FLAG_DEBOUNCED) : (flags & ~FLAG_DEBOUNCED);
+    }
+    _flags[n] = flags;
+
+    _Key<OneButtonTinyArray> key = { *this, n };
+    fsm_t::run(key, flags & FLAG_DEBOUNCED, now);
+  }  // _step()
+};
+
+#endif
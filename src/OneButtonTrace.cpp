@@ -0,0 +1,127 @@
+/**
+ * @file OneButtonTrace.cpp
+ *
+ * @brief Record and replay the raw level changes of a button.
+ *
+ * @author Matthias Hertel, https://www.mathertel.de
+ * @Copyright Copyright (c) by Matthias Hertel, https://www.mathertel.de.
+ *
+ * This work is licensed under a BSD style license. See
+ * http://www.mathertel.de/License.aspx
+ *
+ * More information on: https://www.mathertel.de/Arduino/OneButtonLibrary.aspx
+ *
+ * Changelog: see OneButtonTrace.h
+ */
+
+#include "OneButtonTrace.h"
+
+// ----- Recording -----
+
+void OneButtonTraceBase::record(const bool level, const onebutton_time_t time) {
+  unsigned long delta = 0;
+
+  if (_started) delta = (unsigned long)(onebutton_time_t)(time - _lastTime) << ONEBUTTON_TIME_SHIFT;
+  _started = true;
+  _lastTime = time;
+
+  uint8_t b = (level ? 0x40 : 0x00) | (delta & 0x3F);
+  delta >>= 6;
+  while (delta) {
+    _put(b | 0x80);
+    b = delta & 0x7F;
+    delta >>= 7;
+  }
+  _put(b);
+}  // record()
+
+
+// add a byte and make room by dropping the oldest record when the trace is full.
+void OneButtonTraceBase::_put(const uint8_t b) {
+  if ((uint16_t)(_head - _tail) == _size) _dropRecord();
+  _data[_head & (_size - 1)] = b;
+  _head++;
+}  // _put()
+
+
+void OneButtonTraceBase::_dropRecord() {
+  while (_tail != _head) {
+    uint8_t b = _data[_tail & (_size - 1)];
+    _tail++;
+    if (!(b & 0x80)) break;
+  }
+  _dropped++;
+}  // _dropRecord()
+
+
+uint16_t OneButtonTraceBase::read(uint8_t *buffer, const uint16_t size) {
+  uint16_t len = 0;
+  uint16_t complete = 0;
+
+  // copy up to the end of the last complete record fitting into the buffer.
+  while ((len < size) && ((uint16_t)(_tail + len) != _head)) {
+    uint8_t b = _data[(_tail + len) & (_size - 1)];
+    buffer[len++] = b;
+    if (!(b & 0x80)) complete = len;
+  }
+  _tail += complete;
+  return complete;
+}  // read()
+
+
+// ----- Replay -----
+
+bool OneButtonTraceReplay::next(bool &level, unsigned long &deltaMs) {
+  if (_pos >= _size) return false;
+
+  uint8_t b = _data[_pos++];
+  level = b & 0x40;
+  deltaMs = b & 0x3F;
+
+  uint8_t shift = 6;
+  while ((b & 0x80) && (_pos < _size)) {
+    b = _data[_pos++];
+    deltaMs |= (unsigned long)(b & 0x7F) << shift;
+    shift += 7;
+  }
+  return true;
+}  // next()
+
+
+unsigned long OneButtonTraceReplay::replay(OneButton &button, const unsigned int tickMs, const unsigned long tailMs) {
+  unsigned long now = 0;
+  unsigned long edgeTime = 0;
+  bool level;
+  unsigned long deltaMs;
+  bool started = false;
+  bool current = false;
+
+  _pos = 0;
+  while (next(level, deltaMs)) {
+    if (!started) {
+      // the level before the first record.
+      current = !level;
+      button.tick(current, now);
+      started = true;
+    }
+    edgeTime += deltaMs;
+
+    while (now + tickMs < edgeTime) {
+      now += tickMs;
+      button.tick(current, now);
+    }
+    now = edgeTime;
+    current = level;
+    button.tick(current, now);
+  }
+
+  unsigned long endTime = now + tailMs;
+  while (now + tickMs <= endTime) {
+    now += tickMs;
+    button.tick(current, now);
+  }
+  return now;
+}  // replay()
+
+
+// end.
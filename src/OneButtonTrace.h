@@ -0,0 +1,134 @@
+// -----
+// OneButtonTrace.h - Record the raw level changes of a button into a compact
+// trace and replay it into a OneButton for debugging.
+// This class is implemented for use with the Arduino environment.
+// Copyright (c) by Matthias Hertel, http://www.mathertel.de
+// This work is licensed under a BSD style license. See
+// http://www.mathertel.de/License.aspx More information on:
+// http://www.mathertel.de/Arduino
+// -----
+// 14.10.2026 created to debug the input of buttons in the field.
+// -----
+//
+// Trace format:
+// Every raw level change that reaches the debouncing of the button is one record of 1..5 bytes.
+// The first byte holds the new level in bit 6 (1 = active) and the low 6 bits of the msecs since the previous
+// level change. Bit 7 is set when more bytes with the next 7 bits of the delta time follow.
+// A press of less than 64 msecs with bouncing contacts takes 1 byte per edge, 2 bytes are used up to 8 secs.
+// With ONEBUTTON_TIME_16 the gaps longer than the range of the timebase are shortened.
+
+#ifndef OneButtonTrace_h
+#define OneButtonTrace_h
+
+#include "OneButton.h"
+
+
+/**
+ * Ring buffer with the trace records of a button.
+ *
+ * The button writes a record for every raw level change when recording is enabled by
+ * ONEBUTTON_TRACE and OneButton::attachTrace(). When the buffer is full the oldest records are dropped.
+ * Use the OneButtonTrace<N> template to create a trace with storage.
+ */
+class OneButtonTraceBase {
+public:
+  /**
+   * Add a record for a raw level change. Called by the button.
+   * @param level The new raw level, true when active.
+   * @param time The time of the tick that has seen the level in the timebase of the button.
+   */
+  void record(const bool level, const onebutton_time_t time);
+
+  /**
+   * Take the oldest bytes of the trace, for example to write them to Serial or flash.
+   * Only complete records are taken. When tick() is called from an interrupt, pause it while reading.
+   * @return number of bytes copied to buffer.
+   */
+  uint16_t read(uint8_t *buffer, const uint16_t size);
+
+  /**
+   * @return number of bytes in the trace.
+   */
+  uint16_t available() const {
+    return _head - _tail;
+  }
+
+  /**
+   * @return number of records dropped because the trace was full.
+   */
+  uint16_t getDropped() const {
+    return _dropped;
+  }
+
+protected:
+  OneButtonTraceBase(uint8_t *data, const uint16_t size)
+    : _data(data), _size(size) {}
+
+private:
+  uint8_t *_data;
+  uint16_t _size;
+  uint16_t _head = 0;
+  uint16_t _tail = 0;
+  uint16_t _dropped = 0;
+  bool _started = false;
+  onebutton_time_t _lastTime = 0;
+
+  void _put(const uint8_t b);
+  void _dropRecord();
+};
+
+
+/**
+ * Trace with storage for N bytes.
+ * @tparam N size of the trace in bytes, a power of 2 up to 32768.
+ */
+template <uint16_t N>
+class OneButtonTrace : public OneButtonTraceBase {
+  static_assert((N >= 8) && (N <= 32768) && ((N & (N - 1)) == 0), "N must be a power of 2 from 8 up to 32768");
+
+public:
+  OneButtonTrace()
+    : OneButtonTraceBase(_buffer, N) {}
+
+private:
+  uint8_t _buffer[N];
+};
+
+
+/**
+ * Replay a trace into a button by calling tick(level, now) with the recorded level changes.
+ * The times start at 0 with the level before the first record.
+ */
+class OneButtonTraceReplay {
+public:
+  /**
+   * @param data The bytes of the trace.
+   * @param size The number of bytes.
+   */
+  OneButtonTraceReplay(const uint8_t *data, const size_t size)
+    : _data(data), _size(size) {}
+
+  /**
+   * Decode the next record.
+   * @param level The new raw level, true when active.
+   * @param deltaMs The msecs since the previous level change.
+   * @return false at the end of the trace.
+   */
+  bool next(bool &level, unsigned long &deltaMs);
+
+  /**
+   * Run the button with the whole trace, the button is ticked every tickMs and at every level change.
+   * @param button The button, its events are reported by the attached functions and the returned masks.
+   * @param tickMs msecs between 2 ticks.
+   * @param tailMs msecs to continue after the last level change for the final timeouts.
+   * @return the time of the last tick.
+   */
+  unsigned long replay(OneButton &button, const unsigned int tickMs = 1, const unsigned long tailMs = 2000);
+
+private:
+  const uint8_t *_data;
+  size_t _size;
+  size_t _pos = 0;
+};
+
+#endif
@@ -0,0 +1,153 @@
+// -----
+// OneButtonTypes.h - Common types and definitions used by the OneButton,
+// OneButtonTiny and related classes. Copyright (c) by Matthias Hertel,
+// http://www.mathertel.de This work is licensed under a BSD style license. See
+// http://www.mathertel.de/License.aspx More information on:
+// http://www.mathertel.de/Arduino
+// -----
+// 14.10.2026 created to share definitions between OneButton and OneButtonTiny.
+// 14.10.2026 OneButtonDelegate for member function callbacks.
+// -----
+
+#ifndef OneButtonTypes_h
+#define OneButtonTypes_h
+
+#include <Arduino.h>
+
+// ----- Callback function types -----
+
+extern "C" {
+  typedef void (*callbackFunction)(void);
+  typedef void (*parameterizedCallbackFunction)(void *);
+}
+
+// ----- Member function delegates -----
+
+/**
+ * Non allocating binding of an object and a member function for the attach functions.
+ *
+ * The delegate has a fixed size of 2 pointers: the object and a trampoline function created by the compiler
+ * for the member function. Calling it is a single indirect call, no heap memory is used as by std::function.
+ * Create it by ONEBUTTON_DELEGATE(object, &Class::method) or OneButtonDelegate::create<Class, &Class::method>(object).
+ * The object must stay valid while the delegate is attached.
+ */
+class OneButtonDelegate {
+public:
+  OneButtonDelegate()
+    : _function(NULL), _object(NULL) {}
+
+  /**
+   * A function with a parameter and the value given to it.
+   */
+  OneButtonDelegate(parameterizedCallbackFunction callback, void *context)
+    : _function(callback), _object(context) {}
+
+  /**
+   * A function without parameter.
+   */
+  OneButtonDelegate(callbackFunction callback)
+    : _function(callback ? _callFunction : NULL), _object((void *)callback) {}
+
+  /**
+   * Bind a member function without parameters to an object.
+   */
+  template <class T, void (T::*Method)()>
+  static OneButtonDelegate create(T *object) {
+    return OneButtonDelegate(_callMethod<T, Method>, object);
+  }
+
+  void operator()() const {
+    _function(_object);
+  }
+
+  explicit operator bool() const {
+    return _function != NULL;
+  }
+
+  parameterizedCallbackFunction function() const {
+    return _function;
+  }
+
+  void *parameter() const {
+    return _object;
+  }
+
+private:
+  parameterizedCallbackFunction _function;
+  void *_object;
+
+  template <class T, void (T::*Method)()>
+  static void _callMethod(void *object) {
+    (static_cast<T *>(object)->*Method)();
+  }
+
+  static void _callFunction(void *function) {
+    ((callbackFunction)function)();
+  }
+};
+
+// the class of a member function pointer, used by ONEBUTTON_DELEGATE.
+template <class M>
+struct oneButtonMemberClass;
+
+template <class T>
+struct oneButtonMemberClass<void (T::*)()> {
+  typedef T type;
+};
+
+// Bind a member function to an object: ONEBUTTON_DELEGATE(this, &MyClass::clicked)
+#define ONEBUTTON_DELEGATE(object, method) \
+  OneButtonDelegate::create<oneButtonMemberClass<decltype(method)>::type, method>(object)
+
+// ----- Events -----
+
+// The events detected by the state machine, used by the attachEvent() dispatcher.
+enum oneButtonEvent_t : uint8_t {
+  OBE_PRESS = 0,
+  OBE_CLICK = 1,
+  OBE_DOUBLECLICK = 2,
+  OBE_MULTICLICK = 3,
+  OBE_LONGPRESSSTART = 4,
+  OBE_LONGPRESSSTOP = 5,
+  OBE_DURINGLONGPRESS = 6,
+  OBE_IDLE = 7,
+};
+
+// Bit masks of the events for selecting or reporting a set of events.
+#define OBM_PRESS (1 << OBE_PRESS)
+#define OBM_CLICK (1 << OBE_CLICK)
+#define OBM_DOUBLECLICK (1 << OBE_DOUBLECLICK)
+#define OBM_MULTICLICK (1 << OBE_MULTICLICK)
+#define OBM_LONGPRESSSTART (1 << OBE_LONGPRESSSTART)
+#define OBM_LONGPRESSSTOP (1 << OBE_LONGPRESSSTOP)
+#define OBM_DURINGLONGPRESS (1 << OBE_DURINGLONGPRESS)
+#define OBM_IDLE (1 << OBE_IDLE)
+#define OBM_ALL 0xFF
+
+// ----- Debounce modes -----
+
+// The algorithms for debouncing the raw input level, see setDebounceMode().
+#define OBD_STABLE 0      // a new level is accepted after it was stable for the debounce time (default)
+#define OBD_INTEGRATOR 1  // the time of the active level is added and the time of the inactive level is subtracted,
+                          // a new level is accepted when the sum reaches 0 or the debounce time
+#define OBD_LOCKOUT 2     // a new level is accepted immediately, further changes are ignored for the debounce time
+
+// ----- Auto repeat -----
+
+// One step of an auto repeat acceleration table, see OneButton::setRepeat().
+struct oneButtonRepeatStep_t {
+  uint8_t count;        // number of repeats using this interval, not used for the last step
+  uint16_t intervalMs;  // msecs between 2 repeats
+};
+
+// Compiler and memory barrier for data shared with interrupts or other cores.
+#if defined(__AVR__)
+#define ONEBUTTON_MEMORY_BARRIER() __asm__ __volatile__("" ::: "memory")
+#else
+#define ONEBUTTON_MEMORY_BARRIER() __sync_synchronize()
+#endif
+
+// Returned by nextDeadlineMs() when only a level change can advance the state machine.
+#define ONEBUTTON_NO_DEADLINE ((unsigned long)-1)
+
+#endif